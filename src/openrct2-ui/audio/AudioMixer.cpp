@@ -17,6 +17,7 @@
 #include <openrct2/OpenRCT2.h>
 #include <openrct2/audio/AudioChannel.h>
 #include <openrct2/audio/AudioMixer.h>
+#include <openrct2/audio/AudioMixing.h>
 #include <openrct2/audio/AudioSource.h>
 #include <openrct2/audio/audio.h>
 #include <openrct2/common.h>
@@ -323,13 +324,21 @@ namespace OpenRCT2::Audio
                 buffer = _effectBuffer.data();
             }
 
-            // Apply panning and volume
-            ApplyPan(channel, buffer, bufferLen, byteRate);
-            int32_t mixVolume = ApplyVolume(channel, buffer, bufferLen);
-
-            // Finally mix on to destination buffer
             size_t dstLength = std::min(length, bufferLen);
-            SDL_MixAudioFormat(data, (const uint8_t*)buffer, _format.format, (uint32_t)dstLength, mixVolume);
+            if (_format.format == AUDIO_S16SYS && _format.channels == 2)
+            {
+                // Pan, fade and mix in one pass for the usual device format
+                MixS16StereoChannel(channel, data, buffer, bufferLen, dstLength);
+            }
+            else
+            {
+                // Apply panning and volume
+                ApplyPan(channel, buffer, bufferLen, byteRate);
+                int32_t mixVolume = ApplyVolume(channel, buffer, bufferLen);
+
+                // Finally mix on to destination buffer
+                SDL_MixAudioFormat(data, (const uint8_t*)buffer, _format.format, (uint32_t)dstLength, mixVolume);
+            }
 
             channel->UpdateOldVolume();
         }
@@ -377,7 +386,54 @@ namespace OpenRCT2::Audio
             }
         }
 
-        int32_t ApplyVolume(const IAudioChannel* channel, void* buffer, size_t len)
+        /**
+         * Same result as ApplyPan, ApplyVolume and SDL_MixAudioFormat, but in one pass. The pan and fade steps are
+         * based on the whole buffer even when only part of it is mixed, and the pan only moves half way each buffer,
+         * as it always has.
+         */
+        void MixS16StereoChannel(const IAudioChannel* channel, uint8_t* dst, const void* src, size_t bufferLen, size_t len)
+        {
+            size_t numFrames = len / _format.GetByteRate();
+            size_t numBufferFrames = bufferLen / _format.GetByteRate();
+            if (numFrames == 0)
+            {
+                return;
+            }
+
+            float startPanL = 1;
+            float startPanR = 1;
+            float panStepL = 0;
+            float panStepR = 0;
+            if (channel->GetPan() != 0.5f)
+            {
+                float dt = 1.0f / (numBufferFrames * 2);
+                startPanL = channel->GetOldVolumeL();
+                startPanR = channel->GetOldVolumeR();
+                panStepL = dt * (channel->GetVolumeL() - channel->GetOldVolumeL());
+                panStepR = dt * (channel->GetVolumeR() - channel->GetOldVolumeR());
+            }
+
+            float volumeAdjust = GetVolumeAdjust(channel);
+            int32_t startVolume = (int32_t)(channel->GetOldVolume() * volumeAdjust);
+            int32_t endVolume = (int32_t)(channel->GetVolume() * volumeAdjust);
+            if (channel->IsStopping())
+            {
+                endVolume = 0;
+            }
+
+            float volume = (float)(int32_t)(channel->GetVolume() * volumeAdjust) / MIXER_VOLUME_MAX;
+            float volumeStep = 0;
+            if (startVolume != endVolume)
+            {
+                volume = (float)startVolume / MIXER_VOLUME_MAX;
+                volumeStep = (float)(endVolume - startVolume) / MIXER_VOLUME_MAX / (numBufferFrames * 2);
+            }
+
+            MixS16Stereo(
+                (int16_t*)dst, (const int16_t*)src, numFrames, startPanL, startPanR, panStepL, panStepR, volume, volumeStep);
+        }
+
+        float GetVolumeAdjust(const IAudioChannel* channel) const
         {
             float volumeAdjust = _volume;
             volumeAdjust *= gConfigSound.master_sound_enabled ? (gConfigSound.master_volume / 100.0f) : 0;
@@ -397,7 +453,12 @@ namespace OpenRCT2::Audio
                     volumeAdjust *= _adjustMusicVolume;
                     break;
             }
+            return volumeAdjust;
+        }
 
+        int32_t ApplyVolume(const IAudioChannel* channel, void* buffer, size_t len)
+        {
+            float volumeAdjust = GetVolumeAdjust(channel);
             int32_t startVolume = (int32_t)(channel->GetOldVolume() * volumeAdjust);
             int32_t endVolume = (int32_t)(channel->GetVolume() * volumeAdjust);
             if (channel->IsStopping())
@@ -10,10 +10,13 @@
 #include "DrawingEngineFactory.hpp"
 
 #include <SDL2/SDL.h>
+#include <algorithm>
 #include <cmath>
+#include <cstring>
 #include <openrct2/Game.h>
 #include <openrct2/common.h>
 #include <openrct2/config/Config.h>
+#include <openrct2/drawing/Drawing.h>
 #include <openrct2/drawing/IDrawingEngine.h>
 #include <openrct2/drawing/LightFX.h>
 #include <openrct2/drawing/X8DrawingEngine.h>
@@ -50,6 +53,14 @@ private:
 
     std::vector<uint32_t> _dirtyVisualsTime;
 
+    // The 8-bit frame as it was last uploaded to the screen texture, used to only convert and upload changed blocks
+    std::vector<uint8_t> _presentedBits;
+    std::vector<uint32_t> _convertedBits;
+    bool _screenTextureValid = false;
+    // Palette entries that have changed since the last upload, e.g. by the water animation
+    bool _paletteEntryChanged[256] = {};
+    bool _paletteChanged = false;
+
     bool smoothNN = false;
 
 public:
@@ -159,6 +170,7 @@ public:
         _screenTextureFormat = SDL_AllocFormat(format);
 
         ConfigureBits(width, height, width);
+        _screenTextureValid = false;
     }
 
     void SetPalette(const rct_palette_entry* palette) override
@@ -167,7 +179,13 @@ public:
         {
             for (int32_t i = 0; i < 256; i++)
             {
-                _paletteHWMapped[i] = SDL_MapRGB(_screenTextureFormat, palette[i].red, palette[i].green, palette[i].blue);
+                uint32_t colour = SDL_MapRGB(_screenTextureFormat, palette[i].red, palette[i].green, palette[i].blue);
+                if (_paletteHWMapped[i] != colour)
+                {
+                    _paletteHWMapped[i] = colour;
+                    _paletteEntryChanged[i] = true;
+                    _paletteChanged = true;
+                }
             }
 
 #ifdef __ENABLE_LIGHTFX__
@@ -223,11 +241,19 @@ private:
                 lightfx_render_to_texture(pixels, pitch, _bits, _width, _height, _paletteHWMapped, _lightPaletteHWMapped);
                 SDL_UnlockTexture(_screenTexture);
             }
+            _screenTextureValid = false;
         }
         else
 #endif
         {
-            CopyBitsToTexture(_screenTexture, _bits, (int32_t)_width, (int32_t)_height, _paletteHWMapped);
+            if (_screenTextureFormat->BytesPerPixel == 4)
+            {
+                UploadChangedBlocks();
+            }
+            else
+            {
+                CopyBitsToTexture(_screenTexture, _bits, (int32_t)_width, (int32_t)_height, _paletteHWMapped);
+            }
         }
         if (smoothNN)
         {
@@ -261,6 +287,113 @@ private:
         }
     }
 
+    /**
+     * Converts and uploads only the parts of the screen that differ from the previously presented frame. The frame is
+     * compared rather than relying on the dirty grid because rain, the FPS counter and viewport scrolling all write
+     * to the screen without invalidating it.
+     */
+    void UploadChangedBlocks()
+    {
+        size_t numPixels = _pitch * _height;
+        if (!_screenTextureValid || _presentedBits.size() != numPixels)
+        {
+            _presentedBits.assign(_bits, _bits + numPixels);
+            _convertedBits.resize(numPixels);
+            convert_palette_32_fn(
+                _width, _height, _bits, _convertedBits.data(), _pitch - _width, _pitch - _width, _paletteHWMapped);
+            SDL_UpdateTexture(_screenTexture, nullptr, _convertedBits.data(), _pitch * 4);
+            _screenTextureValid = true;
+            ClearPaletteChanges();
+            return;
+        }
+
+        // Upload each horizontal run of changed blocks as one rectangle
+        uint32_t blockWidth = _dirtyGrid.BlockWidth;
+        uint32_t blockHeight = _dirtyGrid.BlockHeight;
+        for (uint32_t top = 0; top < _height; top += blockHeight)
+        {
+            uint32_t rows = std::min(blockHeight, _height - top);
+            uint32_t runLeft = 0;
+            bool inRun = false;
+            for (uint32_t left = 0; left < _width; left += blockWidth)
+            {
+                uint32_t columns = std::min(blockWidth, _width - left);
+                if (HasBlockChanged(left, top, columns, rows))
+                {
+                    if (!inRun)
+                    {
+                        runLeft = left;
+                        inRun = true;
+                    }
+                }
+                else if (inRun)
+                {
+                    UploadRect(runLeft, top, left - runLeft, rows);
+                    inRun = false;
+                }
+            }
+            if (inRun)
+            {
+                UploadRect(runLeft, top, _width - runLeft, rows);
+            }
+        }
+        ClearPaletteChanges();
+    }
+
+    void ClearPaletteChanges()
+    {
+        if (_paletteChanged)
+        {
+            std::fill(std::begin(_paletteEntryChanged), std::end(_paletteEntryChanged), false);
+            _paletteChanged = false;
+        }
+    }
+
+    bool HasBlockChanged(uint32_t left, uint32_t top, uint32_t columns, uint32_t rows) const
+    {
+        size_t offset = top * _pitch + left;
+        for (uint32_t y = 0; y < rows; y++, offset += _pitch)
+        {
+            if (std::memcmp(_bits + offset, _presentedBits.data() + offset, columns) != 0)
+            {
+                return true;
+            }
+        }
+
+        // Unchanged pixels still need converting again if their palette entry has changed
+        if (_paletteChanged)
+        {
+            offset = top * _pitch + left;
+            for (uint32_t y = 0; y < rows; y++, offset += _pitch)
+            {
+                const uint8_t* src = _bits + offset;
+                for (uint32_t x = 0; x < columns; x++)
+                {
+                    if (_paletteEntryChanged[src[x]])
+                    {
+                        return true;
+                    }
+                }
+            }
+        }
+        return false;
+    }
+
+    void UploadRect(uint32_t left, uint32_t top, uint32_t columns, uint32_t rows)
+    {
+        size_t offset = top * _pitch + left;
+        uint32_t wrap = _pitch - columns;
+        convert_palette_32_fn(columns, rows, _bits + offset, _convertedBits.data() + offset, wrap, wrap, _paletteHWMapped);
+        for (uint32_t y = 0; y < rows; y++)
+        {
+            size_t rowOffset = offset + y * _pitch;
+            std::copy_n(_bits + rowOffset, columns, _presentedBits.data() + rowOffset);
+        }
+
+        SDL_Rect rect = { (int32_t)left, (int32_t)top, (int32_t)columns, (int32_t)rows };
+        SDL_UpdateTexture(_screenTexture, &rect, _convertedBits.data() + offset, _pitch * 4);
+    }
+
     void CopyBitsToTexture(SDL_Texture* texture, uint8_t* src, int32_t width, int32_t height, const uint32_t* palette)
     {
         void* pixels;
@@ -21,6 +21,7 @@
 #include <openrct2/config/Config.h>
 #include <openrct2/core/String.hpp>
 #include <openrct2/localisation/Localisation.h>
+#include <openrct2/localisation/LocalisationService.h>
 #include <openrct2/object/ObjectList.h>
 #include <openrct2/object/ObjectManager.h>
 #include <openrct2/object/ObjectRepository.h>
@@ -221,7 +222,7 @@ static int32_t get_object_from_object_selection(uint8_t object_type, int32_t y);
 static void window_editor_object_selection_manage_tracks();
 static void editor_load_selected_objects();
 static bool filter_selected(uint8_t objectFlags);
-static bool filter_string(const ObjectRepositoryItem* item);
+static bool filter_string(size_t index);
 static bool filter_source(const ObjectRepositoryItem* item);
 static bool filter_chunks(const ObjectRepositoryItem* item);
 static void filter_update_counts();
@@ -254,65 +255,216 @@ struct list_item
 {
     const ObjectRepositoryItem* repositoryItem;
     rct_object_entry* entry;
-    rct_object_filters* filter;
     uint8_t* flags;
 };
 
-static rct_string_id get_ride_type_string_id(const ObjectRepositoryItem* item);
+// Lowercase copies of the strings an object can be searched by, so that they are not rebuilt on every keystroke
+struct search_index_item
+{
+    std::string name;
+    std::string rideType;
+    std::string path;
+    std::string rideTypeName;
+};
 
-using sortFunc_t = bool (*)(const list_item&, const list_item&);
+static rct_string_id get_ride_type_string_id(const ObjectRepositoryItem* item);
 
 static std::vector<list_item> _listItems;
 static int32_t _listSortType = RIDE_SORT_TYPE;
 static bool _listSortDescending = false;
 static void* _loadedObject = nullptr;
 
-static void visible_list_dispose()
+// Search index, in the same order as the object repository items
+static std::vector<search_index_item> _searchIndex;
+// Language the ride type names in the search index were built with
+static int32_t _searchIndexLanguage = -1;
+// Items of each object type, sorted by the sort type in _searchBucketSortTypes
+static std::vector<size_t> _searchBuckets[OBJECT_TYPE_COUNT];
+static int32_t _searchBucketSortTypes[OBJECT_TYPE_COUNT];
+// Items that match _searchString, both as a flag per item and as a list
+static std::vector<uint8_t> _searchMatchFlags;
+static std::vector<size_t> _searchMatches;
+static std::string _searchString;
+static bool _searchMatchesValid = false;
+
+static std::string search_index_to_lower(const utf8* s)
 {
-    _listItems.clear();
-    _listItems.shrink_to_fit();
+    std::string result = s;
+    for (auto& c : result)
+    {
+        c = (char)tolower((unsigned char)c);
+    }
+    return result;
+}
+
+static void search_index_dispose()
+{
+    _searchIndex.clear();
+    _searchIndex.shrink_to_fit();
+    for (auto& bucket : _searchBuckets)
+    {
+        bucket.clear();
+        bucket.shrink_to_fit();
+    }
+    _searchMatchFlags.clear();
+    _searchMatchFlags.shrink_to_fit();
+    _searchMatches.clear();
+    _searchMatches.shrink_to_fit();
+    _searchMatchesValid = false;
+    _searchIndexLanguage = -1;
 }
 
-static bool visible_list_sort_ride_name(const list_item& a, const list_item& b)
+static void search_index_build()
 {
-    auto nameA = a.repositoryItem->Name.c_str();
-    auto nameB = b.repositoryItem->Name.c_str();
-    return strcmp(nameA, nameB) < 0;
+    search_index_dispose();
+
+    size_t numObjects = object_repository_get_items_count();
+    const ObjectRepositoryItem* items = object_repository_get_items();
+    _searchIndex.resize(numObjects);
+    for (size_t i = 0; i < numObjects; i++)
+    {
+        const ObjectRepositoryItem* item = &items[i];
+        uint8_t objectType = item->ObjectEntry.flags & 0x0F;
+
+        auto& indexItem = _searchIndex[i];
+        indexItem.name = search_index_to_lower(item->Name.c_str());
+        indexItem.path = search_index_to_lower(item->Path.c_str());
+        indexItem.rideTypeName = language_get_string(get_ride_type_string_id(item));
+        if (objectType == OBJECT_TYPE_RIDE)
+        {
+            indexItem.rideType = search_index_to_lower(indexItem.rideTypeName.c_str());
+        }
+
+        if (objectType < OBJECT_TYPE_COUNT)
+        {
+            _searchBuckets[objectType].push_back(i);
+        }
+    }
+    for (auto& sortType : _searchBucketSortTypes)
+    {
+        sortType = -1;
+    }
+    _searchMatchFlags.resize(numObjects);
+    _searchIndexLanguage = LocalisationService_GetCurrentLanguage();
 }
 
-static bool visible_list_sort_ride_type(const list_item& a, const list_item& b)
+static bool search_index_matches(size_t index, const std::string& query)
 {
-    auto rideTypeA = language_get_string(get_ride_type_string_id(a.repositoryItem));
-    auto rideTypeB = language_get_string(get_ride_type_string_id(b.repositoryItem));
-    int32_t result = String::Compare(rideTypeA, rideTypeB);
-    return result != 0 ? result < 0 : visible_list_sort_ride_name(a, b);
+    // Nothing to search for
+    if (query.empty())
+        return true;
+
+    // Check if the searched string exists in the name, ride type (rides only), or filename
+    const auto& indexItem = _searchIndex[index];
+    if (indexItem.name.empty())
+        return false;
+    return indexItem.name.find(query) != std::string::npos || indexItem.rideType.find(query) != std::string::npos
+        || indexItem.path.find(query) != std::string::npos;
 }
 
-static void visible_list_refresh(rct_window* w)
+/**
+ * Brings the matches up to date with the filter string. When the string has only been extended, just the items that
+ * matched before are checked again.
+ */
+static void search_index_update()
+{
+    if (_searchIndex.size() != object_repository_get_items_count()
+        || _searchIndexLanguage != LocalisationService_GetCurrentLanguage())
+    {
+        search_index_build();
+    }
+
+    auto query = search_index_to_lower(_filter_string);
+    if (_searchMatchesValid && query == _searchString)
+    {
+        return;
+    }
+
+    std::vector<size_t> matches;
+    if (_searchMatchesValid && query.find(_searchString) != std::string::npos)
+    {
+        for (auto i : _searchMatches)
+        {
+            _searchMatchFlags[i] = search_index_matches(i, query);
+            if (_searchMatchFlags[i])
+            {
+                matches.push_back(i);
+            }
+        }
+    }
+    else
+    {
+        for (size_t i = 0; i < _searchIndex.size(); i++)
+        {
+            _searchMatchFlags[i] = search_index_matches(i, query);
+            if (_searchMatchFlags[i])
+            {
+                matches.push_back(i);
+            }
+        }
+    }
+
+    _searchMatches = std::move(matches);
+    _searchString = std::move(query);
+    _searchMatchesValid = true;
+}
+
+static void search_index_sort_bucket(int32_t objectType)
+{
+    if (_searchBucketSortTypes[objectType] == _listSortType)
+    {
+        return;
+    }
+
+    const ObjectRepositoryItem* items = object_repository_get_items();
+    auto& bucket = _searchBuckets[objectType];
+    auto sortByName = [items](size_t a, size_t b) -> bool { return strcmp(items[a].Name.c_str(), items[b].Name.c_str()) < 0; };
+    switch (_listSortType)
+    {
+        case RIDE_SORT_TYPE:
+            std::stable_sort(bucket.begin(), bucket.end(), [sortByName](size_t a, size_t b) -> bool {
+                int32_t result = String::Compare(_searchIndex[a].rideTypeName, _searchIndex[b].rideTypeName);
+                return result != 0 ? result < 0 : sortByName(a, b);
+            });
+            break;
+        case RIDE_SORT_RIDE:
+            std::stable_sort(bucket.begin(), bucket.end(), sortByName);
+            break;
+        default:
+            log_warning("Wrong sort type %d, leaving list as-is.", _listSortType);
+            break;
+    }
+    _searchBucketSortTypes[objectType] = _listSortType;
+}
+
+static void visible_list_dispose()
 {
-    int32_t numObjects = (int32_t)object_repository_get_items_count();
+    _listItems.clear();
+    _listItems.shrink_to_fit();
+}
 
+static void visible_list_refresh(rct_window* w)
+{
     visible_list_dispose();
     w->selected_list_item = -1;
 
+    search_index_update();
+
+    // The buckets are kept sorted, so filtering them keeps the list in order
+    int32_t objectType = get_selected_object_type(w);
+    search_index_sort_bucket(objectType);
+
     const ObjectRepositoryItem* items = object_repository_get_items();
-    for (int32_t i = 0; i < numObjects; i++)
+    for (auto i : _searchBuckets[objectType])
     {
         uint8_t selectionFlags = _objectSelectionFlags[i];
         const ObjectRepositoryItem* item = &items[i];
-        uint8_t objectType = item->ObjectEntry.flags & 0x0F;
-        if (objectType == get_selected_object_type(w) && !(selectionFlags & OBJECT_SELECTION_FLAG_6) && filter_source(item)
-            && filter_string(item) && filter_chunks(item) && filter_selected(selectionFlags))
+        if (!(selectionFlags & OBJECT_SELECTION_FLAG_6) && filter_source(item) && filter_string(i) && filter_chunks(item)
+            && filter_selected(selectionFlags))
         {
-            rct_object_filters* filter = new rct_object_filters;
-            filter->ride.category[0] = 0;
-            filter->ride.category[1] = 0;
-            filter->ride.ride_type = 0;
-
             list_item currentListItem;
             currentListItem.repositoryItem = item;
             currentListItem.entry = (rct_object_entry*)&item->ObjectEntry;
-            currentListItem.filter = filter;
             currentListItem.flags = &_objectSelectionFlags[i];
             _listItems.push_back(std::move(currentListItem));
         }
@@ -322,29 +474,9 @@ static void visible_list_refresh(rct_window* w)
     {
         visible_list_dispose();
     }
-    else
+    else if (_listSortDescending)
     {
-        sortFunc_t sortFunc = nullptr;
-        switch (_listSortType)
-        {
-            case RIDE_SORT_TYPE:
-                sortFunc = visible_list_sort_ride_type;
-                break;
-            case RIDE_SORT_RIDE:
-                sortFunc = visible_list_sort_ride_name;
-                break;
-            default:
-                log_warning("Wrong sort type %d, leaving list as-is.", _listSortType);
-                break;
-        }
-        if (sortFunc != nullptr)
-        {
-            std::sort(_listItems.begin(), _listItems.end(), sortFunc);
-            if (_listSortDescending)
-            {
-                std::reverse(_listItems.begin(), _listItems.end());
-            }
-        }
+        std::reverse(_listItems.begin(), _listItems.end());
     }
     window_invalidate(w);
 }
@@ -405,6 +537,7 @@ rct_window* window_editor_object_selection_open()
     window->max_width = 1200;
     window->max_height = 1000;
 
+    search_index_build();
     visible_list_refresh(window);
 
     return window;
@@ -443,6 +576,7 @@ static void window_editor_object_selection_close(rct_window* w)
     context_broadcast_intent(&intent);
 
     visible_list_dispose();
+    search_index_dispose();
 
     intent = Intent(INTENT_ACTION_REFRESH_SCENERY);
     context_broadcast_intent(&intent);
@@ -1360,45 +1494,9 @@ static bool filter_selected(uint8_t objectFlag)
     }
 }
 
-static bool filter_string(const ObjectRepositoryItem* item)
+static bool filter_string(size_t index)
 {
-    // Nothing to search for
-    if (_filter_string[0] == '\0')
-        return true;
-
-    // Object doesn't have a name
-    if (item->Name.empty())
-        return false;
-
-    // Get ride type
-    const char* rideTypeName = language_get_string(get_ride_type_string_id(item));
-
-    // Get object name (ride/vehicle for rides) and type name (rides only)
-    char name_lower[MAX_PATH];
-    char type_lower[MAX_PATH];
-    char object_path[MAX_PATH];
-    char filter_lower[sizeof(_filter_string)];
-    safe_strcpy(name_lower, item->Name.c_str(), MAX_PATH);
-    safe_strcpy(type_lower, rideTypeName, MAX_PATH);
-    safe_strcpy(object_path, item->Path.c_str(), MAX_PATH);
-    safe_strcpy(filter_lower, _filter_string, sizeof(_filter_string));
-
-    // Make use of lowercase characters only
-    for (int32_t i = 0; name_lower[i] != '\0'; i++)
-        name_lower[i] = (char)tolower(name_lower[i]);
-    for (int32_t i = 0; type_lower[i] != '\0'; i++)
-        type_lower[i] = (char)tolower(type_lower[i]);
-    for (int32_t i = 0; object_path[i] != '\0'; i++)
-        object_path[i] = (char)tolower(object_path[i]);
-    for (int32_t i = 0; filter_lower[i] != '\0'; i++)
-        filter_lower[i] = (char)tolower(filter_lower[i]);
-
-    // Check if the searched string exists in the name, ride type, or filename
-    bool inName = strstr(name_lower, filter_lower) != nullptr;
-    bool inRideType = ((item->ObjectEntry.flags & 0x0F) == OBJECT_TYPE_RIDE) && strstr(type_lower, filter_lower) != nullptr;
-    bool inPath = strstr(object_path, filter_lower) != nullptr;
-
-    return inName || inRideType || inPath;
+    return _searchMatchFlags[index] != 0;
 }
 
 static bool sources_match(uint8_t source)
@@ -1469,12 +1567,13 @@ static void filter_update_counts()
             _filter_object_counts[i] = 0;
         }
 
-        size_t numObjects = object_repository_get_items_count();
+        // Only the items matching the filter string can be counted
+        search_index_update();
         const ObjectRepositoryItem* items = object_repository_get_items();
-        for (size_t i = 0; i < numObjects; i++)
+        for (auto i : _searchMatches)
         {
             const ObjectRepositoryItem* item = &items[i];
-            if (filter_source(item) && filter_string(item) && filter_chunks(item) && filter_selected(selectionFlags[i]))
+            if (filter_source(item) && filter_chunks(item) && filter_selected(selectionFlags[i]))
             {
                 uint8_t objectType = item->ObjectEntry.flags & 0xF;
                 _filter_object_counts[objectType]++;
@@ -121,7 +121,7 @@ rct_window* window_title_menu_open()
 
 static void window_title_menu_scenarioselect_callback(const utf8* path)
 {
-    context_load_park_from_file(path);
+    context_load_park_from_file_async(path);
 }
 
 static void window_title_menu_mouseup(rct_window* w, rct_widgetindex widgetIndex)
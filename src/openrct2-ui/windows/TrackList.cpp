@@ -22,6 +22,7 @@
 #include <openrct2/ride/TrackDesignRepository.h>
 #include <openrct2/sprites.h>
 #include <openrct2/windows/Intent.h>
+#include <string>
 #include <vector>
 
 // clang-format off
@@ -98,6 +99,16 @@ static rct_window_event_list window_track_list_events = {
 // clang-format on
 
 #define TRACK_DESIGN_INDEX_UNLOADED UINT16_MAX
+#define TRACK_PREVIEW_CACHE_SIZE 16
+
+struct track_preview_cache_entry
+{
+    std::string path;
+    bool scenery_toggle;
+    money32 cost;
+    uint8_t track_flags;
+    std::vector<uint8_t> pixels;
+};
 
 ride_list_item _window_track_list_item;
 
@@ -107,6 +118,8 @@ static std::vector<uint16_t> _filteredTrackIds;
 static uint16_t _loadedTrackDesignIndex;
 static rct_track_td6* _loadedTrackDesign;
 static std::vector<uint8_t> _trackDesignPreviewPixels;
+// Previews of the designs selected recently, so that going back to one does not place and draw it again
+static std::vector<track_preview_cache_entry> _trackDesignPreviewCache;
 
 static void track_list_load_designs(ride_list_item item);
 static bool track_list_load_design_for_preview(utf8* path);
@@ -212,6 +225,8 @@ static void window_track_list_close(rct_window* w)
     _loadedTrackDesign = nullptr;
     _trackDesignPreviewPixels.clear();
     _trackDesignPreviewPixels.shrink_to_fit();
+    _trackDesignPreviewCache.clear();
+    _trackDesignPreviewCache.shrink_to_fit();
 
     // Dispose track list
     for (auto& trackDesign : _trackDesigns)
@@ -801,6 +816,32 @@ static void track_list_load_designs(ride_list_item item)
     window_track_list_filter_list();
 }
 
+static void track_list_draw_preview(const utf8* path)
+{
+    auto cached = std::find_if(
+        _trackDesignPreviewCache.begin(), _trackDesignPreviewCache.end(),
+        [path](const track_preview_cache_entry& entry) {
+            return entry.path == path && entry.scenery_toggle == gTrackDesignSceneryToggle;
+        });
+    if (cached != _trackDesignPreviewCache.end())
+    {
+        // Drawing the preview also works out the cost and vehicle availability
+        _loadedTrackDesign->cost = cached->cost;
+        _loadedTrackDesign->track_flags = cached->track_flags;
+        std::copy(cached->pixels.begin(), cached->pixels.end(), _trackDesignPreviewPixels.begin());
+        return;
+    }
+
+    track_design_draw_preview(_loadedTrackDesign, _trackDesignPreviewPixels.data());
+
+    if (_trackDesignPreviewCache.size() >= TRACK_PREVIEW_CACHE_SIZE)
+    {
+        _trackDesignPreviewCache.erase(_trackDesignPreviewCache.begin());
+    }
+    _trackDesignPreviewCache.push_back({ path, gTrackDesignSceneryToggle, _loadedTrackDesign->cost,
+                                         _loadedTrackDesign->track_flags, _trackDesignPreviewPixels });
+}
+
 static bool track_list_load_design_for_preview(utf8* path)
 {
     // Dispose currently loaded track
@@ -812,7 +853,7 @@ static bool track_list_load_design_for_preview(utf8* path)
     {
         if (drawing_engine_get_type() != DRAWING_ENGINE_OPENGL)
         {
-            track_design_draw_preview(_loadedTrackDesign, _trackDesignPreviewPixels.data());
+            track_list_draw_preview(path);
         }
         return true;
     }
@@ -8,10 +8,12 @@
  *****************************************************************************/
 
 #include <algorithm>
+#include <atomic>
 #include <cmath>
 #include <exception>
 #include <memory>
 #include <string>
+#include <thread>
 #ifdef __EMSCRIPTEN__
 #    include <emscripten.h>
 #endif // __EMSCRIPTEN__
@@ -25,6 +27,7 @@
 #include "OpenRCT2.h"
 #include "ParkImporter.h"
 #include "PlatformEnvironment.h"
+#include "ReplayManager.h"
 #include "Version.h"
 #include "audio/AudioContext.h"
 #include "audio/audio.h"
@@ -74,6 +77,30 @@ using namespace OpenRCT2::Ui;
 
 namespace OpenRCT2
 {
+    /**
+     * A park being loaded by IContext::LoadParkFromFileAsync. The background thread fills in the results, which the main
+     * thread only reads once Finished has been set.
+     */
+    struct ParkLoadJob
+    {
+        std::string Path;
+        bool LoadTitleScreenOnFail = false;
+        // Where the load was started from, the result is discarded if the player has moved on to another park since
+        uint16_t ScreenFlags = 0;
+        uint32_t GameStateInitCount = 0;
+        std::thread Thread;
+        std::atomic<bool> Cancelled{ false };
+        std::atomic<bool> Finished{ false };
+
+        ClassifiedFileInfo Info;
+        std::unique_ptr<IParkImporter> Importer;
+        std::vector<rct_object_entry> RequiredObjects;
+        // Set if the file could not be read, which leaves the current park untouched
+        std::string ReadError;
+        // Set if the park could not be decoded
+        std::exception_ptr LoadError;
+    };
+
     class Context : public IContext
     {
     private:
@@ -88,6 +115,7 @@ namespace OpenRCT2
         std::unique_ptr<IObjectManager> _objectManager;
         std::unique_ptr<ITrackDesignRepository> _trackDesignRepository;
         std::unique_ptr<IScenarioRepository> _scenarioRepository;
+        std::unique_ptr<IReplayManager> _replayManager;
 #ifdef __ENABLE_DISCORD__
         std::unique_ptr<DiscordService> _discordService;
 #endif
@@ -99,6 +127,9 @@ namespace OpenRCT2
         // Game states
         std::unique_ptr<TitleScreen> _titleScreen;
         std::unique_ptr<GameState> _gameState;
+        std::unique_ptr<ParkLoadJob> _parkLoadJob;
+        // Jobs that were cancelled or replaced, kept until their thread has finished so that the UI never waits for them
+        std::vector<std::unique_ptr<ParkLoadJob>> _cancelledParkLoadJobs;
 
         int32_t _drawingEngineType = DRAWING_ENGINE_SOFTWARE;
         std::unique_ptr<IDrawingEngine> _drawingEngine;
@@ -135,6 +166,13 @@ namespace OpenRCT2
 
         ~Context() override
         {
+            CancelParkLoad();
+            for (auto& job : _cancelledParkLoadJobs)
+            {
+                job->Thread.join();
+            }
+            _cancelledParkLoadJobs.clear();
+
             // Requires this as otherwise it will try to access Instance from other destructors.
             // after setting Instance to nullptr.
             if (_objectManager)
@@ -196,6 +234,11 @@ namespace OpenRCT2
             return _scenarioRepository.get();
         }
 
+        IReplayManager* GetReplayManager() override
+        {
+            return _replayManager.get();
+        }
+
         int32_t GetDrawingEngineType() override
         {
             return _drawingEngineType;
@@ -319,6 +362,7 @@ namespace OpenRCT2
             _objectManager = CreateObjectManager(*_objectRepository);
             _trackDesignRepository = CreateTrackDesignRepository(_env);
             _scenarioRepository = CreateScenarioRepository(_env);
+            _replayManager = CreateReplayManager();
 #ifdef __ENABLE_DISCORD__
             _discordService = std::make_unique<DiscordService>();
 #endif
@@ -495,97 +539,18 @@ namespace OpenRCT2
             {
                 if (info.Type == FILE_TYPE::SAVED_GAME || info.Type == FILE_TYPE::SCENARIO)
                 {
-                    std::unique_ptr<IParkImporter> parkImporter;
-                    if (info.Version <= FILE_TYPE_S4_CUTOFF)
-                    {
-                        // Save is an S4 (RCT1 format)
-                        parkImporter = ParkImporter::CreateS4();
-                    }
-                    else
-                    {
-                        // Save is an S6 (RCT2 format)
-                        parkImporter = ParkImporter::CreateS6(*_objectRepository);
-                    }
-
+                    auto parkImporter = CreateParkImporter(info);
                     try
                     {
                         auto result = parkImporter->LoadFromStream(
                             stream, info.Type == FILE_TYPE::SCENARIO, false, path.c_str());
                         _objectManager->LoadObjects(result.RequiredObjects.data(), result.RequiredObjects.size());
-                        parkImporter->Import();
-                        String::Set(gScenarioSavePath, Util::CountOf(gScenarioSavePath), path.c_str());
-                        String::Set(gCurrentLoadedPath, Util::CountOf(gCurrentLoadedPath), path.c_str());
-                        gFirstTimeSaving = true;
-                        game_fix_save_vars();
-                        sprite_position_tween_reset();
-                        gScreenAge = 0;
-                        gLastAutoSaveUpdate = AUTOSAVE_PAUSE;
-                        if (info.Type == FILE_TYPE::SAVED_GAME)
-                        {
-                            if (network_get_mode() == NETWORK_MODE_CLIENT)
-                            {
-                                network_close();
-                            }
-                            game_load_init();
-                            if (network_get_mode() == NETWORK_MODE_SERVER)
-                            {
-                                network_send_map();
-                            }
-                        }
-                        else
-                        {
-                            scenario_begin();
-                            if (network_get_mode() == NETWORK_MODE_SERVER)
-                            {
-                                network_send_map();
-                            }
-                            if (network_get_mode() == NETWORK_MODE_CLIENT)
-                            {
-                                network_close();
-                            }
-                        }
-                        // This ensures that the newly loaded save reflects the user's
-                        // 'show real names of guests' option, now that it's a global setting
-                        peep_update_names(gConfigGeneral.show_real_names_of_guests);
+                        ImportPark(*parkImporter, info, path);
                         return true;
                     }
-                    catch (const ObjectLoadException& e)
+                    catch (const std::exception&)
                     {
-                        // This option is used when loading parks from the command line
-                        // to ensure that the title sequence loads before the window
-                        if (loadTitleScreenFirstOnFail)
-                        {
-                            title_load();
-                        }
-                        // The path needs to be duplicated as it's a const here
-                        // which the window function doesn't like
-                        auto intent = Intent(WC_OBJECT_LOAD_ERROR);
-                        intent.putExtra(INTENT_EXTRA_PATH, path);
-                        intent.putExtra(INTENT_EXTRA_LIST, (void*)e.MissingObjects.data());
-                        intent.putExtra(INTENT_EXTRA_LIST_COUNT, (uint32_t)e.MissingObjects.size());
-
-                        auto windowManager = _uiContext->GetWindowManager();
-                        windowManager->OpenIntent(&intent);
-                    }
-                    catch (const UnsupportedRCTCFlagException& e)
-                    {
-                        // This option is used when loading parks from the command line
-                        // to ensure that the title sequence loads before the window
-                        if (loadTitleScreenFirstOnFail)
-                        {
-                            title_load();
-                        }
-
-                        auto windowManager = _uiContext->GetWindowManager();
-                        set_format_arg(0, uint16_t, e.Flag);
-                        windowManager->ShowError(STR_FAILED_TO_LOAD_IMCOMPATIBLE_RCTC_FLAG, STR_NONE);
-                    }
-                    catch (const std::exception& e)
-                    {
-                        // If loading the SV6 or SV4 failed for a reason other than invalid objects
-                        // the current park state will be corrupted so just go back to the title screen.
-                        title_load();
-                        Console::Error::WriteLine(e.what());
+                        HandleParkLoadError(std::current_exception(), path, loadTitleScreenFirstOnFail);
                     }
                 }
                 else
@@ -600,7 +565,260 @@ namespace OpenRCT2
             return false;
         }
 
+        void LoadParkFromFileAsync(const std::string& path, bool loadTitleScreenOnFail) final override
+        {
+            CancelParkLoad();
+
+            _parkLoadJob = std::make_unique<ParkLoadJob>();
+            _parkLoadJob->Path = path;
+            _parkLoadJob->LoadTitleScreenOnFail = loadTitleScreenOnFail;
+            _parkLoadJob->ScreenFlags = gScreenFlags;
+            _parkLoadJob->GameStateInitCount = _gameState != nullptr ? _gameState->GetInitCount() : 0;
+            _parkLoadJob->Thread = std::thread(&Context::RunParkLoadJob, this, std::ref(*_parkLoadJob));
+
+            // Show that the park is loading, closing the window cancels the load
+            const utf8* fileName = Path::GetFileName(path.c_str());
+            utf8 message[256];
+            format_string(message, sizeof(message), STR_LOADING_PARK, &fileName);
+            auto intent = Intent(WC_NETWORK_STATUS);
+            intent.putExtra(INTENT_EXTRA_MESSAGE, std::string{ message });
+            intent.putExtra(INTENT_EXTRA_CALLBACK, []() -> void { GetContext()->CancelParkLoad(); });
+            context_open_intent(&intent);
+        }
+
+        bool IsLoadingPark() const final override
+        {
+            return _parkLoadJob != nullptr;
+        }
+
+        void CancelParkLoad() final override
+        {
+            // The thread is left to finish in the background, UpdateParkLoad joins it once it has
+            if (_parkLoadJob != nullptr)
+            {
+                _parkLoadJob->Cancelled = true;
+                _cancelledParkLoadJobs.push_back(std::move(_parkLoadJob));
+            }
+        }
+
     private:
+        std::unique_ptr<IParkImporter> CreateParkImporter(const ClassifiedFileInfo& info)
+        {
+            if (info.Version <= FILE_TYPE_S4_CUTOFF)
+            {
+                // Save is an S4 (RCT1 format)
+                return ParkImporter::CreateS4();
+            }
+            else
+            {
+                // Save is an S6 (RCT2 format)
+                return ParkImporter::CreateS6(*_objectRepository);
+            }
+        }
+
+        /**
+         * Imports a park whose objects have been loaded, replacing the current one.
+         */
+        void ImportPark(IParkImporter& parkImporter, const ClassifiedFileInfo& info, const std::string& path)
+        {
+            parkImporter.Import();
+            String::Set(gScenarioSavePath, Util::CountOf(gScenarioSavePath), path.c_str());
+            String::Set(gCurrentLoadedPath, Util::CountOf(gCurrentLoadedPath), path.c_str());
+            gFirstTimeSaving = true;
+            game_fix_save_vars();
+            sprite_position_tween_reset();
+            gScreenAge = 0;
+            gLastAutoSaveUpdate = AUTOSAVE_PAUSE;
+            if (info.Type == FILE_TYPE::SAVED_GAME)
+            {
+                if (network_get_mode() == NETWORK_MODE_CLIENT)
+                {
+                    network_close();
+                }
+                game_load_init();
+                if (network_get_mode() == NETWORK_MODE_SERVER)
+                {
+                    network_send_map();
+                }
+            }
+            else
+            {
+                scenario_begin();
+                if (network_get_mode() == NETWORK_MODE_SERVER)
+                {
+                    network_send_map();
+                }
+                if (network_get_mode() == NETWORK_MODE_CLIENT)
+                {
+                    network_close();
+                }
+            }
+            // This ensures that the newly loaded save reflects the user's
+            // 'show real names of guests' option, now that it's a global setting
+            peep_update_names(gConfigGeneral.show_real_names_of_guests);
+        }
+
+        void HandleParkLoadError(std::exception_ptr error, const std::string& path, bool loadTitleScreenFirstOnFail)
+        {
+            try
+            {
+                std::rethrow_exception(error);
+            }
+            catch (const ObjectLoadException& e)
+            {
+                // This option is used when loading parks from the command line
+                // to ensure that the title sequence loads before the window
+                if (loadTitleScreenFirstOnFail)
+                {
+                    title_load();
+                }
+                // The path needs to be duplicated as it's a const here
+                // which the window function doesn't like
+                auto intent = Intent(WC_OBJECT_LOAD_ERROR);
+                intent.putExtra(INTENT_EXTRA_PATH, path);
+                intent.putExtra(INTENT_EXTRA_LIST, (void*)e.MissingObjects.data());
+                intent.putExtra(INTENT_EXTRA_LIST_COUNT, (uint32_t)e.MissingObjects.size());
+
+                auto windowManager = _uiContext->GetWindowManager();
+                windowManager->OpenIntent(&intent);
+            }
+            catch (const UnsupportedRCTCFlagException& e)
+            {
+                // This option is used when loading parks from the command line
+                // to ensure that the title sequence loads before the window
+                if (loadTitleScreenFirstOnFail)
+                {
+                    title_load();
+                }
+
+                auto windowManager = _uiContext->GetWindowManager();
+                set_format_arg(0, uint16_t, e.Flag);
+                windowManager->ShowError(STR_FAILED_TO_LOAD_IMCOMPATIBLE_RCTC_FLAG, STR_NONE);
+            }
+            catch (const std::exception& e)
+            {
+                // If loading the SV6 or SV4 failed for a reason other than invalid objects
+                // the current park state will be corrupted so just go back to the title screen.
+                title_load();
+                Console::Error::WriteLine(e.what());
+            }
+        }
+
+        /**
+         * Runs on the park load thread. Only reads and decodes the file into the job's own importer. Packed objects are
+         * kept by the importer, the object repository and the game are only touched by the main thread.
+         */
+        void RunParkLoadJob(ParkLoadJob& job)
+        {
+            try
+            {
+                auto fs = FileStream(job.Path, FILE_MODE_OPEN);
+                if (!TryClassifyFile(&fs, &job.Info))
+                {
+                    job.ReadError = "Unable to detect file type.";
+                }
+                else if (job.Info.Type != FILE_TYPE::SAVED_GAME && job.Info.Type != FILE_TYPE::SCENARIO)
+                {
+                    job.ReadError = "Invalid file type.";
+                }
+                else
+                {
+                    job.Importer = CreateParkImporter(job.Info);
+                    job.Importer->SetDeferPackedObjects(true);
+                    try
+                    {
+                        auto result = job.Importer->LoadFromStream(
+                            &fs, job.Info.Type == FILE_TYPE::SCENARIO, false, job.Path.c_str());
+                        job.RequiredObjects = result.RequiredObjects;
+                    }
+                    catch (const std::exception&)
+                    {
+                        job.LoadError = std::current_exception();
+                    }
+                }
+            }
+            catch (const std::exception& e)
+            {
+                job.ReadError = e.what();
+            }
+            job.Finished = true;
+        }
+
+        /**
+         * Finishes the background park load once its thread is done. The packed objects are exported, the objects are
+         * loaded and the park is imported here as they change the object repository and the game state.
+         */
+        void UpdateParkLoad()
+        {
+            // Forget cancelled jobs once their thread is done
+            for (auto it = _cancelledParkLoadJobs.begin(); it != _cancelledParkLoadJobs.end();)
+            {
+                if ((*it)->Finished)
+                {
+                    (*it)->Thread.join();
+                    it = _cancelledParkLoadJobs.erase(it);
+                }
+                else
+                {
+                    it++;
+                }
+            }
+
+            if (_parkLoadJob == nullptr)
+            {
+                return;
+            }
+
+            // Discard the load if the player has moved on to another park meanwhile, they would not expect it to be
+            // replaced. The title sequence replaces its park by itself, so only leaving the title screen counts there.
+            bool parkChanged;
+            if (_parkLoadJob->ScreenFlags & SCREEN_FLAGS_TITLE_DEMO)
+            {
+                parkChanged = !(gScreenFlags & SCREEN_FLAGS_TITLE_DEMO);
+            }
+            else
+            {
+                uint32_t initCount = _gameState != nullptr ? _gameState->GetInitCount() : 0;
+                parkChanged = gScreenFlags != _parkLoadJob->ScreenFlags || initCount != _parkLoadJob->GameStateInitCount;
+            }
+            if (parkChanged)
+            {
+                log_verbose("Discarding the load of '%s' as the park has changed", _parkLoadJob->Path.c_str());
+                CancelParkLoad();
+                context_force_close_window_by_class(WC_NETWORK_STATUS);
+                return;
+            }
+
+            if (!_parkLoadJob->Finished)
+            {
+                return;
+            }
+
+            auto job = std::move(_parkLoadJob);
+            job->Thread.join();
+            context_force_close_window_by_class(WC_NETWORK_STATUS);
+            if (!job->ReadError.empty())
+            {
+                Console::Error::WriteLine("%s", job->ReadError.c_str());
+                return;
+            }
+
+            try
+            {
+                if (job->LoadError)
+                {
+                    std::rethrow_exception(job->LoadError);
+                }
+                job->Importer->ExportPackedObjects();
+                _objectManager->LoadObjects(job->RequiredObjects.data(), job->RequiredObjects.size());
+                ImportPark(*job->Importer, job->Info, job->Path);
+            }
+            catch (const std::exception&)
+            {
+                HandleParkLoadError(std::current_exception(), job->Path, job->LoadTitleScreenOnFail);
+            }
+        }
+
         std::string GetOrPromptRCT2Path()
         {
             auto result = std::string();
@@ -922,6 +1140,7 @@ namespace OpenRCT2
             }
 
             date_update_real_time_of_day();
+            UpdateParkLoad();
 
             if (gIntroState != INTRO_STATE_NONE)
             {
@@ -1061,6 +1280,11 @@ bool context_load_park_from_file(const utf8* path)
     return GetContext()->LoadParkFromFile(path);
 }
 
+void context_load_park_from_file_async(const utf8* path)
+{
+    GetContext()->LoadParkFromFileAsync(path);
+}
+
 bool context_load_park_from_stream(void* stream)
 {
     return GetContext()->LoadParkFromStream((IStream*)stream, "");
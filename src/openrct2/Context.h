@@ -65,6 +65,7 @@ namespace OpenRCT2
 {
     class GameState;
     interface IPlatformEnvironment;
+    interface IReplayManager;
 
     namespace Audio
     {
@@ -102,6 +103,7 @@ namespace OpenRCT2
         virtual IObjectRepository& GetObjectRepository() abstract;
         virtual ITrackDesignRepository* GetTrackDesignRepository() abstract;
         virtual IScenarioRepository* GetScenarioRepository() abstract;
+        virtual IReplayManager* GetReplayManager() abstract;
         virtual int32_t GetDrawingEngineType() abstract;
         virtual Drawing::IDrawingEngine* GetDrawingEngine() abstract;
 
@@ -113,6 +115,15 @@ namespace OpenRCT2
         virtual bool LoadParkFromFile(const std::string& path, bool loadTitleScreenOnFail = false) abstract;
         virtual bool LoadParkFromStream(IStream * stream, const std::string& path, bool loadTitleScreenFirstOnFail = false)
             abstract;
+
+        /**
+         * Starts loading a park in the background. The file is read and decoded on another thread while the game keeps
+         * running, then its objects are loaded and the park is imported on the main thread once that is done. The load
+         * is discarded if another park is loaded meanwhile.
+         */
+        virtual void LoadParkFromFileAsync(const std::string& path, bool loadTitleScreenOnFail = false) abstract;
+        virtual bool IsLoadingPark() const abstract;
+        virtual void CancelParkLoad() abstract;
         virtual void WriteLine(const std::string& s) abstract;
         virtual void Finish() abstract;
         virtual void Quit() abstract;
@@ -238,4 +249,5 @@ bool context_read_bmp(void** outPixels, uint32_t* outWidth, uint32_t* outHeight,
 void context_quit();
 const utf8* context_get_path_legacy(int32_t pathId);
 bool context_load_park_from_file(const utf8* path);
+void context_load_park_from_file_async(const utf8* path);
 bool context_load_park_from_stream(void* stream);
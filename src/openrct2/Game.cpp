@@ -16,6 +16,7 @@
 #include "Input.h"
 #include "OpenRCT2.h"
 #include "ParkImporter.h"
+#include "ReplayManager.h"
 #include "audio/audio.h"
 #include "config/Config.h"
 #include "core/FileScanner.h"
@@ -468,6 +469,15 @@ int32_t game_do_command_p(
                 }
             }
 
+            if (gGameCommandNestLevel == 1 && !(flags & GAME_COMMAND_FLAG_GHOST) && !(flags & GAME_COMMAND_FLAG_5))
+            {
+                auto replayManager = GetContext()->GetReplayManager();
+                if (replayManager != nullptr && replayManager->IsRecording())
+                {
+                    replayManager->AddGameCommand(*eax, *ebx, *ecx, *edx, *esi, *edi, *ebp, game_command_playerid);
+                }
+            }
+
             // Second call to actually perform the operation
             new_game_command_table[command](eax, ebx, ecx, edx, esi, edi, ebp);
 
@@ -1131,6 +1141,10 @@ void game_load_init()
     {
         reset_sprite_spatial_index();
     }
+    else
+    {
+        reset_vehicle_spatial_index();
+    }
     reset_all_sprite_quadrant_placements();
     scenery_set_default_placement_configuration();
 
@@ -1362,7 +1376,7 @@ static void game_load_or_quit_no_save_prompt_callback(int32_t result, const utf8
     if (result == MODAL_RESULT_OK)
     {
         window_close_by_class(WC_EDITOR_OBJECT_SELECTION);
-        context_load_park_from_file(path);
+        context_load_park_from_file_async(path);
     }
 }
 
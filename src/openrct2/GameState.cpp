@@ -13,6 +13,7 @@
 #include "Editor.h"
 #include "Input.h"
 #include "OpenRCT2.h"
+#include "ReplayManager.h"
 #include "interface/Screenshot.h"
 #include "localisation/Date.h"
 #include "localisation/Localisation.h"
@@ -43,6 +44,7 @@ GameState::GameState()
  */
 void GameState::InitAll(int32_t mapSize)
 {
+    _initCount++;
     gInMapInitCode = true;
 
     map_init(mapSize);
@@ -234,6 +236,14 @@ void GameState::UpdateLogic()
         network_check_desynchronization();
     }
 
+    _inUpdateLogic = true;
+
+    auto replayManager = GetContext()->GetReplayManager();
+    if (replayManager != nullptr)
+    {
+        replayManager->Update();
+    }
+
     date_update();
     _date = Date(gDateMonthTicks, gDateMonthTicks);
 
@@ -297,4 +307,6 @@ void GameState::UpdateLogic()
     gCurrentTicks++;
     gScenarioTicks++;
     gSavedAge++;
+
+    _inUpdateLogic = false;
 }
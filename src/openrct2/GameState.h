@@ -25,6 +25,8 @@ namespace OpenRCT2
     private:
         std::unique_ptr<Park> _park;
         Date _date;
+        bool _inUpdateLogic = false;
+        uint32_t _initCount = 0;
 
     public:
         GameState();
@@ -38,6 +40,17 @@ namespace OpenRCT2
         {
             return *_park;
         }
+        bool IsInUpdateLogic() const
+        {
+            return _inUpdateLogic;
+        }
+        /**
+         * Gets the number of times InitAll has been called, which changes whenever the park is replaced.
+         */
+        uint32_t GetInitCount() const
+        {
+            return _initCount;
+        }
 
         void InitAll(int32_t mapSize);
         void Update();
@@ -59,6 +59,13 @@ public:
 
     virtual void Import() abstract;
     virtual bool GetDetails(scenario_index_entry * dst) abstract;
+
+    /**
+     * Packed objects are normally added to the object repository while the park is read. When deferred, they are kept
+     * until ExportPackedObjects is called instead, so that the park can be read away from the main thread.
+     */
+    virtual void SetDeferPackedObjects(bool defer) abstract;
+    virtual void ExportPackedObjects() abstract;
 };
 
 namespace ParkImporter
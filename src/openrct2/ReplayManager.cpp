@@ -0,0 +1,557 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2018 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "ReplayManager.h"
+
+#include "Cheats.h"
+#include "Context.h"
+#include "Game.h"
+#include "GameState.h"
+#include "OpenRCT2.h"
+#include "ParkImporter.h"
+#include "Version.h"
+#include "actions/GameAction.h"
+#include "core/DataSerialiser.h"
+#include "core/File.h"
+#include "core/Memory.hpp"
+#include "core/MemoryStream.h"
+#include "core/Util.hpp"
+#include "object/ObjectManager.h"
+#include "object/ObjectRepository.h"
+#include "rct2/S6Exporter.h"
+#include "scenario/Scenario.h"
+#include "util/Util.h"
+#include "world/Park.h"
+#include "world/Sprite.h"
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+namespace OpenRCT2
+{
+    // "ORRP" in little endian
+    constexpr uint32_t REPLAY_MAGIC = 0x5052524F;
+    constexpr uint16_t REPLAY_VERSION = 1;
+
+    struct ReplayCommand
+    {
+        uint32_t tick = 0;
+        uint32_t args[7]{};
+        uint8_t playerId = 0;
+        GameAction::Ptr action;
+    };
+
+    struct ReplayChecksum
+    {
+        uint32_t tick = 0;
+        uint32_t srand0 = 0;
+        std::string spriteHash;
+    };
+
+    struct ReplayRecordData
+    {
+        std::string gameVersion;
+        uint32_t tickStart = 0;
+        uint32_t tickEnd = 0;
+        uint32_t checksumInterval = 0;
+        MemoryStream parkData;
+        std::vector<ReplayCommand> commands;
+        std::vector<ReplayChecksum> checksums;
+    };
+
+    // Cheats are not part of the S6 format but affect how commands are applied.
+    static bool* const ReplayCheats[] = {
+        &gCheatsSandboxMode,
+        &gCheatsDisableClearanceChecks,
+        &gCheatsDisableSupportLimits,
+        &gCheatsDisableTrainLengthLimit,
+        &gCheatsEnableChainLiftOnAllTrack,
+        &gCheatsShowAllOperatingModes,
+        &gCheatsShowVehiclesFromOtherTrackTypes,
+        &gCheatsFastLiftHill,
+        &gCheatsDisableBrakesFailure,
+        &gCheatsDisableAllBreakdowns,
+        &gCheatsBuildInPauseMode,
+        &gCheatsIgnoreRideIntensity,
+        &gCheatsDisableVandalism,
+        &gCheatsDisableLittering,
+        &gCheatsNeverendingMarketing,
+        &gCheatsFreezeClimate,
+        &gCheatsDisablePlantAging,
+        &gCheatsAllowArbitraryRideTypeChanges,
+        &gCheatsDisableRideValueAging,
+        &gCheatsIgnoreResearchStatus,
+    };
+
+    class ReplayManager final : public IReplayManager
+    {
+    private:
+        enum class ReplayMode
+        {
+            NONE,
+            RECORDING,
+            PLAYING,
+        };
+
+        ReplayMode _mode = ReplayMode::NONE;
+        std::string _recordPath;
+        std::unique_ptr<ReplayRecordData> _data;
+        size_t _nextCommand = 0;
+        size_t _nextChecksum = 0;
+        bool _mismatch = false;
+
+    public:
+        bool IsReplaying() const override
+        {
+            return _mode == ReplayMode::PLAYING;
+        }
+
+        bool IsRecording() const override
+        {
+            return _mode == ReplayMode::RECORDING;
+        }
+
+        bool IsPlaybackStateMismatching() const override
+        {
+            return _mismatch;
+        }
+
+        uint32_t GetPlaybackEndTick() const override
+        {
+            return _data != nullptr ? _data->tickEnd : 0;
+        }
+
+        void Update() override
+        {
+            if (_mode == ReplayMode::RECORDING)
+            {
+                if (_data->checksumInterval != 0 && (gCurrentTicks - _data->tickStart) % _data->checksumInterval == 0)
+                {
+                    _data->checksums.push_back(CreateChecksum());
+                }
+            }
+            else if (_mode == ReplayMode::PLAYING)
+            {
+                ExecuteCommands(gCurrentTicks);
+                CheckState();
+                if (gCurrentTicks >= _data->tickEnd && _nextCommand >= _data->commands.size())
+                {
+                    StopPlayback();
+                }
+            }
+        }
+
+        void AddGameAction(const GameAction* action) override
+        {
+            uint32_t tick;
+            if (!TryGetRecordTick(action->GetFlags(), &tick))
+                return;
+
+            // Make a copy via serialisation so the recording is independent of the original action
+            MemoryStream stream;
+            DataSerialiser dsOut(true, stream);
+            action->Serialise(dsOut);
+
+            ReplayCommand command;
+            command.tick = tick;
+            command.playerId = (uint8_t)action->GetPlayer();
+            command.action = GameActions::Create(action->GetType());
+
+            stream.SetPosition(0);
+            DataSerialiser dsIn(false, stream);
+            command.action->Serialise(dsIn);
+            _data->commands.push_back(std::move(command));
+        }
+
+        void AddGameCommand(
+            uint32_t eax, uint32_t ebx, uint32_t ecx, uint32_t edx, uint32_t esi, uint32_t edi, uint32_t ebp,
+            uint8_t playerId) override
+        {
+            uint32_t tick;
+            if (!TryGetRecordTick(ebx, &tick))
+                return;
+
+            ReplayCommand command;
+            command.tick = tick;
+            command.args[0] = eax;
+            command.args[1] = ebx;
+            command.args[2] = ecx;
+            command.args[3] = edx;
+            command.args[4] = esi;
+            command.args[5] = edi;
+            command.args[6] = ebp;
+            command.playerId = playerId;
+            _data->commands.push_back(std::move(command));
+        }
+
+        bool StartRecording(const std::string& path, uint32_t checksumInterval) override
+        {
+            if (_mode != ReplayMode::NONE)
+                return false;
+
+            auto data = std::make_unique<ReplayRecordData>();
+            data->gameVersion = gVersionInfoFull;
+            data->tickStart = gCurrentTicks;
+            data->checksumInterval = checksumInterval;
+            if (!SavePark(data->parkData))
+                return false;
+
+            _data = std::move(data);
+            _recordPath = path;
+            _mode = ReplayMode::RECORDING;
+            return true;
+        }
+
+        bool StopRecording() override
+        {
+            if (_mode != ReplayMode::RECORDING)
+                return false;
+
+            _mode = ReplayMode::NONE;
+            _data->tickEnd = gCurrentTicks;
+
+            bool result = WriteReplayFile(_recordPath, *_data);
+            _data = nullptr;
+            return result;
+        }
+
+        bool StartPlayback(const std::string& path) override
+        {
+            if (_mode != ReplayMode::NONE)
+                return false;
+
+            auto data = std::make_unique<ReplayRecordData>();
+            if (!ReadReplayFile(path, *data))
+                return false;
+
+            if (data->gameVersion != gVersionInfoFull)
+            {
+                log_warning(
+                    "Replay was recorded with '%s', playback may not be deterministic.", data->gameVersion.c_str());
+            }
+
+            data->parkData.SetPosition(0);
+            if (!LoadPark(data->parkData))
+                return false;
+
+            _data = std::move(data);
+            _nextCommand = 0;
+            _nextChecksum = 0;
+            _mismatch = false;
+            _mode = ReplayMode::PLAYING;
+            return true;
+        }
+
+        bool StopPlayback() override
+        {
+            if (_mode != ReplayMode::PLAYING)
+                return false;
+
+            _mode = ReplayMode::NONE;
+            return true;
+        }
+
+    private:
+        /**
+         * Commands applied outside of the logic update take effect before the next tick. Commands applied by the
+         * network queue at the end of a tick take effect before the following tick. Any other command applied
+         * during the logic update is issued by the simulation itself and will be reissued during playback.
+         */
+        bool TryGetRecordTick(uint32_t flags, uint32_t* tick) const
+        {
+            if (_mode != ReplayMode::RECORDING)
+                return false;
+
+            auto gameState = GetContext()->GetGameState();
+            if (gameState != nullptr && gameState->IsInUpdateLogic())
+            {
+                if (!(flags & GAME_COMMAND_FLAG_NETWORKED))
+                    return false;
+
+                *tick = gCurrentTicks + 1;
+                return true;
+            }
+            *tick = gCurrentTicks;
+            return true;
+        }
+
+        void ExecuteCommands(uint32_t tick)
+        {
+            auto& commands = _data->commands;
+            while (_nextCommand < commands.size() && commands[_nextCommand].tick <= tick)
+            {
+                auto& command = commands[_nextCommand];
+                if (command.action != nullptr)
+                {
+                    GameActions::Execute(command.action.get());
+                }
+                else
+                {
+                    const auto& args = command.args;
+                    game_command_playerid = command.playerId;
+                    game_do_command(args[0], args[1], args[2], args[3], args[4], args[5], args[6]);
+                }
+                _nextCommand++;
+            }
+        }
+
+        void CheckState()
+        {
+            auto& checksums = _data->checksums;
+            while (_nextChecksum < checksums.size() && checksums[_nextChecksum].tick <= gCurrentTicks)
+            {
+                const auto& expected = checksums[_nextChecksum];
+                if (expected.tick == gCurrentTicks)
+                {
+                    auto actual = CreateChecksum();
+                    if (actual.srand0 != expected.srand0 || actual.spriteHash != expected.spriteHash)
+                    {
+                        if (!_mismatch)
+                        {
+                            log_warning(
+                                "Replay state mismatch at tick %u, srand0 %08X (expected %08X), sprites %s (expected %s)",
+                                gCurrentTicks, actual.srand0, expected.srand0, actual.spriteHash.c_str(),
+                                expected.spriteHash.c_str());
+                        }
+                        _mismatch = true;
+                    }
+                }
+                _nextChecksum++;
+            }
+        }
+
+        static ReplayChecksum CreateChecksum()
+        {
+            ReplayChecksum checksum;
+            checksum.tick = gCurrentTicks;
+            checksum.srand0 = gScenarioSrand0;
+            auto spriteHash = sprite_checksum();
+            if (spriteHash != nullptr)
+            {
+                checksum.spriteHash = spriteHash;
+            }
+            return checksum;
+        }
+
+        static bool SavePark(MemoryStream& stream)
+        {
+            try
+            {
+                auto exporter = std::make_unique<S6Exporter>();
+                exporter->ExportObjectsList = GetContext()->GetObjectManager().GetPackableObjects();
+                exporter->Export();
+                exporter->SaveGame(&stream);
+
+                // Write other data not in normal save files
+                stream.Write(gSpriteSpatialIndex, sizeof(gSpriteSpatialIndex));
+                stream.WriteValue<uint32_t>(gGamePaused);
+                stream.WriteValue<int32_t>(_guestGenerationProbability);
+                stream.WriteValue<int32_t>(_suggestedGuestMaximum);
+                for (auto cheat : ReplayCheats)
+                {
+                    stream.WriteValue<uint8_t>(*cheat);
+                }
+                return true;
+            }
+            catch (const std::exception& e)
+            {
+                log_error("Unable to save park for replay: %s", e.what());
+            }
+            return false;
+        }
+
+        static bool LoadPark(MemoryStream& stream)
+        {
+            try
+            {
+                auto context = GetContext();
+                auto importer = ParkImporter::CreateS6(context->GetObjectRepository());
+                auto loadResult = importer->LoadFromStream(&stream, false);
+                auto& objectManager = context->GetObjectManager();
+                objectManager.LoadObjects(loadResult.RequiredObjects.data(), loadResult.RequiredObjects.size());
+                importer->Import();
+                sprite_position_tween_reset();
+
+                // Read checksum
+                [[maybe_unused]] uint32_t checksum = stream.ReadValue<uint32_t>();
+
+                // Read other data not in normal save files
+                // game_load_init rebuilds the quadrant lists, keep the recorded ones as their order affects the
+                // simulation. The heads are stored here, the links are part of the sprite data.
+                auto spatialIndex = std::make_unique<uint16_t[]>(Util::CountOf(gSpriteSpatialIndex));
+                stream.Read(spatialIndex.get(), sizeof(gSpriteSpatialIndex));
+                auto nextInQuadrant = std::make_unique<uint16_t[]>(MAX_SPRITES);
+                for (size_t i = 0; i < MAX_SPRITES; i++)
+                {
+                    nextInQuadrant[i] = get_sprite(i)->generic.next_in_quadrant;
+                }
+                gGamePaused = stream.ReadValue<uint32_t>();
+                _guestGenerationProbability = stream.ReadValue<int32_t>();
+                _suggestedGuestMaximum = stream.ReadValue<int32_t>();
+                for (auto cheat : ReplayCheats)
+                {
+                    *cheat = stream.ReadValue<uint8_t>() != 0;
+                }
+
+                game_load_init();
+                std::copy_n(spatialIndex.get(), Util::CountOf(gSpriteSpatialIndex), gSpriteSpatialIndex);
+                for (size_t i = 0; i < MAX_SPRITES; i++)
+                {
+                    get_sprite(i)->generic.next_in_quadrant = nextInQuadrant[i];
+                }
+                reset_vehicle_spatial_index();
+                gScreenFlags = SCREEN_FLAGS_PLAYING;
+                gLastAutoSaveUpdate = AUTOSAVE_PAUSE;
+                return true;
+            }
+            catch (const std::exception& e)
+            {
+                log_error("Unable to load park from replay: %s", e.what());
+            }
+            return false;
+        }
+
+        static bool WriteReplayFile(const std::string& path, ReplayRecordData& data)
+        {
+            MemoryStream stream;
+            DataSerialiser serialiser(true, stream);
+
+            uint32_t parkDataSize = (uint32_t)data.parkData.GetLength();
+            serialiser << data.gameVersion << data.tickStart << data.tickEnd << data.checksumInterval << parkDataSize;
+            stream.Write(data.parkData.GetData(), parkDataSize);
+
+            uint32_t numCommands = (uint32_t)data.commands.size();
+            serialiser << numCommands;
+            for (auto& command : data.commands)
+            {
+                bool isAction = command.action != nullptr;
+                serialiser << command.tick << command.playerId << isAction;
+                if (isAction)
+                {
+                    uint32_t type = command.action->GetType();
+                    serialiser << type;
+                    command.action->Serialise(serialiser);
+                }
+                else
+                {
+                    for (auto& arg : command.args)
+                    {
+                        serialiser << arg;
+                    }
+                }
+            }
+
+            uint32_t numChecksums = (uint32_t)data.checksums.size();
+            serialiser << numChecksums;
+            for (auto& checksum : data.checksums)
+            {
+                serialiser << checksum.tick << checksum.srand0 << checksum.spriteHash;
+            }
+
+            size_t compressedSize = 0;
+            uint8_t* compressed = util_zlib_deflate((const uint8_t*)stream.GetData(), stream.GetLength(), &compressedSize);
+            if (compressed == nullptr)
+                return false;
+
+            bool result = false;
+            try
+            {
+                MemoryStream fileStream;
+                fileStream.WriteValue<uint32_t>(REPLAY_MAGIC);
+                fileStream.WriteValue<uint16_t>(REPLAY_VERSION);
+                fileStream.WriteValue<uint32_t>((uint32_t)stream.GetLength());
+                fileStream.Write(compressed, compressedSize);
+                File::WriteAllBytes(path, fileStream.GetData(), fileStream.GetLength());
+                result = true;
+            }
+            catch (const std::exception& e)
+            {
+                log_error("Unable to write replay '%s': %s", path.c_str(), e.what());
+            }
+            free(compressed);
+            return result;
+        }
+
+        static bool ReadReplayFile(const std::string& path, ReplayRecordData& data)
+        {
+            try
+            {
+                auto fileData = File::ReadAllBytes(path);
+                MemoryStream fileStream(fileData.data(), fileData.size());
+                if (fileStream.ReadValue<uint32_t>() != REPLAY_MAGIC)
+                    throw std::runtime_error("Not a replay file.");
+                if (fileStream.ReadValue<uint16_t>() != REPLAY_VERSION)
+                    throw std::runtime_error("Unsupported replay version.");
+
+                size_t decompressedSize = fileStream.ReadValue<uint32_t>();
+                size_t headerSize = (size_t)fileStream.GetPosition();
+                uint8_t* decompressed = util_zlib_inflate(
+                    fileData.data() + headerSize, fileData.size() - headerSize, &decompressedSize);
+                if (decompressed == nullptr)
+                    throw std::runtime_error("Unable to decompress replay.");
+
+                MemoryStream stream(decompressed, decompressedSize, MEMORY_ACCESS::READ | MEMORY_ACCESS::OWNER);
+                DataSerialiser serialiser(false, stream);
+
+                uint32_t parkDataSize = 0;
+                serialiser << data.gameVersion << data.tickStart << data.tickEnd << data.checksumInterval << parkDataSize;
+                auto parkData = stream.ReadArray<uint8_t>(parkDataSize);
+                data.parkData.Write(parkData, parkDataSize);
+                Memory::FreeArray(parkData, parkDataSize);
+
+                uint32_t numCommands = 0;
+                serialiser << numCommands;
+                for (uint32_t i = 0; i < numCommands; i++)
+                {
+                    ReplayCommand command;
+                    bool isAction = false;
+                    serialiser << command.tick << command.playerId << isAction;
+                    if (isAction)
+                    {
+                        uint32_t type = 0;
+                        serialiser << type;
+                        command.action = GameActions::IsValidId(type) ? GameActions::Create(type) : nullptr;
+                        if (command.action == nullptr)
+                            throw std::runtime_error("Unknown game action type.");
+                        command.action->Serialise(serialiser);
+                    }
+                    else
+                    {
+                        for (auto& arg : command.args)
+                        {
+                            serialiser << arg;
+                        }
+                    }
+                    data.commands.push_back(std::move(command));
+                }
+
+                uint32_t numChecksums = 0;
+                serialiser << numChecksums;
+                for (uint32_t i = 0; i < numChecksums; i++)
+                {
+                    ReplayChecksum checksum;
+                    serialiser << checksum.tick << checksum.srand0 << checksum.spriteHash;
+                    data.checksums.push_back(std::move(checksum));
+                }
+                return true;
+            }
+            catch (const std::exception& e)
+            {
+                log_error("Unable to read replay '%s': %s", path.c_str(), e.what());
+            }
+            return false;
+        }
+    };
+
+    std::unique_ptr<IReplayManager> CreateReplayManager()
+    {
+        return std::make_unique<ReplayManager>();
+    }
+} // namespace OpenRCT2
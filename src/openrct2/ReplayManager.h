@@ -0,0 +1,56 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2018 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "common.h"
+
+#include <memory>
+#include <string>
+
+struct GameAction;
+
+namespace OpenRCT2
+{
+    constexpr uint32_t REPLAY_DEFAULT_CHECKSUM_INTERVAL = 40;
+
+    /**
+     * Records the initial park state and every game command that is applied to it so that a
+     * session can be re-executed deterministically, e.g. for reproducing desyncs or benchmarking.
+     */
+    interface IReplayManager
+    {
+        virtual ~IReplayManager() = default;
+
+        virtual bool IsReplaying() const abstract;
+        virtual bool IsRecording() const abstract;
+        virtual bool IsPlaybackStateMismatching() const abstract;
+
+        /**
+         * Called at the start of each logic tick. Executes any recorded commands for the current
+         * tick during playback and writes / verifies the state checkpoints.
+         */
+        virtual void Update() abstract;
+
+        virtual void AddGameAction(const GameAction* action) abstract;
+        virtual void AddGameCommand(
+            uint32_t eax, uint32_t ebx, uint32_t ecx, uint32_t edx, uint32_t esi, uint32_t edi, uint32_t ebp,
+            uint8_t playerId) abstract;
+
+        virtual bool StartRecording(const std::string& path, uint32_t checksumInterval = REPLAY_DEFAULT_CHECKSUM_INTERVAL)
+            abstract;
+        virtual bool StopRecording() abstract;
+
+        virtual bool StartPlayback(const std::string& path) abstract;
+        virtual bool StopPlayback() abstract;
+        virtual uint32_t GetPlaybackEndTick() const abstract;
+    };
+
+    std::unique_ptr<IReplayManager> CreateReplayManager();
+} // namespace OpenRCT2
@@ -10,6 +10,7 @@
 #include "GameAction.h"
 
 #include "../Context.h"
+#include "../ReplayManager.h"
 #include "../core/Guard.hpp"
 #include "../core/Memory.hpp"
 #include "../core/MemoryStream.h"
@@ -46,6 +47,7 @@ GameActionResult::GameActionResult(GA_ERROR error, rct_string_id title, rct_stri
 namespace GameActions
 {
     static GameActionFactory _actions[GAME_COMMAND_COUNT];
+    static int32_t _executeNestLevel = 0;
 
     GameActionFactory Register(uint32_t id, GameActionFactory factory)
     {
@@ -67,6 +69,12 @@ namespace GameActions
         initialized = true;
     }
 
+    bool IsValidId(uint32_t id)
+    {
+        Initialize();
+        return id < Util::CountOf(_actions) && _actions[id] != nullptr;
+    }
+
     std::unique_ptr<GameAction> Create(uint32_t id)
     {
         Initialize();
@@ -179,7 +187,9 @@ namespace GameActions
             log_verbose("[%s] GameAction::Execute\n", "sv");
 
             // Execute the action, changing the game state
+            _executeNestLevel++;
             result = action->Execute();
+            _executeNestLevel--;
 
             gCommandPosition.x = result->Position.x;
             gCommandPosition.y = result->Position.y;
@@ -195,6 +205,15 @@ namespace GameActions
 
             if (!(actionFlags & GA_FLAGS::CLIENT_ONLY))
             {
+                auto replayManager = OpenRCT2::GetContext()->GetReplayManager();
+                // Only record top-level actions, nested ones are replayed by their parent
+                bool topLevel = _executeNestLevel == 0 && gGameCommandNestLevel == 0;
+                if (replayManager != nullptr && replayManager->IsRecording() && result->Error == GA_ERROR::OK && topLevel
+                    && !(flags & GAME_COMMAND_FLAG_GHOST) && !(flags & GAME_COMMAND_FLAG_5))
+                {
+                    replayManager->AddGameAction(action);
+                }
+
                 if (network_get_mode() == NETWORK_MODE_SERVER && result->Error == GA_ERROR::OK)
                 {
                     const uint32_t playerId = action->GetPlayer();
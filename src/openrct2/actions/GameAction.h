@@ -232,6 +232,7 @@ namespace GameActions
 {
     void Initialize();
     void Register();
+    bool IsValidId(uint32_t id);
     GameAction::Ptr Create(uint32_t id);
     GameActionResult::Ptr Query(const GameAction* action);
     GameActionResult::Ptr Execute(const GameAction* action);
@@ -0,0 +1,100 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2018 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "AudioMixing.h"
+
+#include <algorithm>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#    define OPENRCT2_AUDIO_SSE2
+#    include <emmintrin.h>
+#endif
+
+namespace OpenRCT2::Audio
+{
+    static int16_t MixSampleS16(int16_t dst, int16_t src, float gain)
+    {
+        int32_t sample = dst + (int32_t)(src * gain);
+        return (int16_t)std::clamp<int32_t>(sample, INT16_MIN, INT16_MAX);
+    }
+
+    static void MixS16StereoFrames(
+        int16_t* dst, const int16_t* src, size_t firstFrame, size_t numFrames, float startPanL, float startPanR,
+        float panStepL, float panStepR, float startVolume, float volumeStep)
+    {
+        for (size_t i = firstFrame; i < numFrames; i++)
+        {
+            float gainL = (startPanL + panStepL * i) * (startVolume + volumeStep * (i * 2));
+            float gainR = (startPanR + panStepR * i) * (startVolume + volumeStep * (i * 2 + 1));
+            dst[i * 2] = MixSampleS16(dst[i * 2], src[i * 2], gainL);
+            dst[i * 2 + 1] = MixSampleS16(dst[i * 2 + 1], src[i * 2 + 1], gainR);
+        }
+    }
+
+    void MixS16StereoScalar(
+        int16_t* dst, const int16_t* src, size_t numFrames, float startPanL, float startPanR, float panStepL, float panStepR,
+        float startVolume, float volumeStep)
+    {
+        MixS16StereoFrames(dst, src, 0, numFrames, startPanL, startPanR, panStepL, panStepR, startVolume, volumeStep);
+    }
+
+#ifdef OPENRCT2_AUDIO_SSE2
+    void MixS16Stereo(
+        int16_t* dst, const int16_t* src, size_t numFrames, float startPanL, float startPanR, float panStepL, float panStepR,
+        float startVolume, float volumeStep)
+    {
+        // Four frames are processed at a time, the gains of the first two are in *Lo and of the last two in *Hi
+        const __m128 panStart = _mm_setr_ps(startPanL, startPanR, startPanL, startPanR);
+        const __m128 panSteps = _mm_setr_ps(panStepL, panStepR, panStepL, panStepR);
+        const __m128 volumeSteps = _mm_set1_ps(volumeStep);
+        const __m128 frameLo = _mm_setr_ps(0, 0, 1, 1);
+        const __m128 sampleLo = _mm_setr_ps(0, 1, 2, 3);
+
+        size_t numVectorFrames = numFrames & ~(size_t)3;
+        for (size_t i = 0; i < numVectorFrames; i += 4)
+        {
+            // Gains are computed from the frame index rather than accumulated, so they match the scalar loop
+            __m128 frame = _mm_add_ps(_mm_set1_ps((float)i), frameLo);
+            __m128 sample = _mm_add_ps(_mm_set1_ps((float)(i * 2)), sampleLo);
+            __m128 panLo = _mm_add_ps(panStart, _mm_mul_ps(panSteps, frame));
+            __m128 panHi = _mm_add_ps(panStart, _mm_mul_ps(panSteps, _mm_add_ps(frame, _mm_set1_ps(2))));
+            __m128 volumeLo = _mm_add_ps(_mm_set1_ps(startVolume), _mm_mul_ps(volumeSteps, sample));
+            __m128 volumeHi = _mm_add_ps(
+                _mm_set1_ps(startVolume), _mm_mul_ps(volumeSteps, _mm_add_ps(sample, _mm_set1_ps(4))));
+            __m128 gainLo = _mm_mul_ps(panLo, volumeLo);
+            __m128 gainHi = _mm_mul_ps(panHi, volumeHi);
+
+            __m128i srcSamples = _mm_loadu_si128((const __m128i*)&src[i * 2]);
+            __m128i dstSamples = _mm_loadu_si128((const __m128i*)&dst[i * 2]);
+
+            // Sign extend to 32-bit and scale
+            __m128i srcLo = _mm_srai_epi32(_mm_unpacklo_epi16(srcSamples, srcSamples), 16);
+            __m128i srcHi = _mm_srai_epi32(_mm_unpackhi_epi16(srcSamples, srcSamples), 16);
+            __m128i scaledLo = _mm_cvttps_epi32(_mm_mul_ps(_mm_cvtepi32_ps(srcLo), gainLo));
+            __m128i scaledHi = _mm_cvttps_epi32(_mm_mul_ps(_mm_cvtepi32_ps(srcHi), gainHi));
+
+            // Add in 32-bit and saturate once when packing, like the scalar loop, as a gain above 1 can overflow the
+            // scaled samples
+            __m128i dstLo = _mm_srai_epi32(_mm_unpacklo_epi16(dstSamples, dstSamples), 16);
+            __m128i dstHi = _mm_srai_epi32(_mm_unpackhi_epi16(dstSamples, dstSamples), 16);
+            __m128i mixed = _mm_packs_epi32(_mm_add_epi32(dstLo, scaledLo), _mm_add_epi32(dstHi, scaledHi));
+            _mm_storeu_si128((__m128i*)&dst[i * 2], mixed);
+        }
+        MixS16StereoFrames(
+            dst, src, numVectorFrames, numFrames, startPanL, startPanR, panStepL, panStepR, startVolume, volumeStep);
+    }
+#else
+    void MixS16Stereo(
+        int16_t* dst, const int16_t* src, size_t numFrames, float startPanL, float startPanR, float panStepL, float panStepR,
+        float startVolume, float volumeStep)
+    {
+        MixS16StereoScalar(dst, src, numFrames, startPanL, startPanR, panStepL, panStepR, startVolume, volumeStep);
+    }
+#endif
+} // namespace OpenRCT2::Audio
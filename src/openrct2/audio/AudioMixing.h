@@ -0,0 +1,31 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2018 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../common.h"
+
+namespace OpenRCT2::Audio
+{
+    /**
+     * Scales interleaved 16-bit stereo frames and adds them on to dst with saturation, applying panning, volume fades
+     * and mixing of a channel in a single pass. Frame i is scaled by a pan of startPan + panStep * i for each side,
+     * and sample j (both sides counted, so 2 * i and 2 * i + 1) by a volume of startVolume + volumeStep * j.
+     */
+    void MixS16Stereo(
+        int16_t* dst, const int16_t* src, size_t numFrames, float startPanL, float startPanR, float panStepL, float panStepR,
+        float startVolume, float volumeStep);
+
+    /**
+     * Portable implementation of MixS16Stereo, used on platforms without SIMD support and for benchmarking.
+     */
+    void MixS16StereoScalar(
+        int16_t* dst, const int16_t* src, size_t numFrames, float startPanL, float startPanR, float panStepL, float panStepR,
+        float startVolume, float volumeStep);
+} // namespace OpenRCT2::Audio
@@ -0,0 +1,94 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2018 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "../audio/AudioMixing.h"
+#include "../core/Console.hpp"
+#include "CommandLine.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+using namespace OpenRCT2::Audio;
+
+// Matches the format and buffer size the mixer requests from the audio device
+constexpr int32_t BENCH_AUDIO_FREQUENCY = 22050;
+constexpr size_t BENCH_AUDIO_CHUNK_FRAMES = 2048;
+
+using MixS16StereoFunc = void (*)(int16_t*, const int16_t*, size_t, float, float, float, float, float, float);
+
+static exitcode_t HandleBenchAudio(CommandLineArgEnumerator* argEnumerator);
+
+// clang-format off
+const CommandLineCommand CommandLine::BenchAudioCommands[]
+{
+    // Main commands
+    DefineCommand("", "[channel count] [seconds]", nullptr, HandleBenchAudio),
+    CommandTableEnd
+};
+// clang-format on
+
+static double BenchmarkMix(MixS16StereoFunc mix, const std::vector<std::vector<int16_t>>& sources, int32_t numChunks)
+{
+    std::vector<int16_t> output(BENCH_AUDIO_CHUNK_FRAMES * 2);
+    auto startTime = std::chrono::high_resolution_clock::now();
+    for (int32_t chunk = 0; chunk < numChunks; chunk++)
+    {
+        std::fill(output.begin(), output.end(), 0);
+        for (size_t i = 0; i < sources.size(); i++)
+        {
+            // Move the channels around so that every chunk pans and fades like vehicles passing by
+            float startPan = (float)((chunk + i) % 16) / 16;
+            float panStep = 1.0f / 16 / (BENCH_AUDIO_CHUNK_FRAMES * 2);
+            float volumeStep = 0.25f / (BENCH_AUDIO_CHUNK_FRAMES * 2);
+            mix(output.data(), sources[i].data(), BENCH_AUDIO_CHUNK_FRAMES, startPan, 1 - startPan, panStep, -panStep, 0.5f,
+                volumeStep);
+        }
+    }
+    std::chrono::duration<double> duration = std::chrono::high_resolution_clock::now() - startTime;
+    return duration.count();
+}
+
+/**
+ * Measures how long mixing a number of panned and fading sound effect channels takes, without requiring an audio device.
+ */
+static exitcode_t HandleBenchAudio(CommandLineArgEnumerator* argEnumerator)
+{
+    int32_t numChannels = 64;
+    int32_t seconds = 60;
+    argEnumerator->TryPopInteger(&numChannels);
+    argEnumerator->TryPopInteger(&seconds);
+    if (numChannels <= 0 || seconds <= 0)
+    {
+        Console::Error::WriteLine("Channel count and seconds must be positive.");
+        return EXITCODE_FAIL;
+    }
+
+    // Deterministic noise so that the results can be compared between runs
+    std::vector<std::vector<int16_t>> sources(numChannels);
+    uint32_t seed = 0x12345678;
+    for (auto& source : sources)
+    {
+        source.resize(BENCH_AUDIO_CHUNK_FRAMES * 2);
+        for (auto& sample : source)
+        {
+            seed = seed * 1103515245 + 12345;
+            sample = (int16_t)(seed >> 16);
+        }
+    }
+
+    int32_t numChunks = (int32_t)((seconds * BENCH_AUDIO_FREQUENCY) / BENCH_AUDIO_CHUNK_FRAMES);
+    double scalarTime = BenchmarkMix(MixS16StereoScalar, sources, numChunks);
+    double mixTime = BenchmarkMix(MixS16Stereo, sources, numChunks);
+
+    Console::WriteLine("Mixing %d channels for %d seconds of audio:", numChannels, seconds);
+    Console::WriteLine("  scalar: %.3f seconds (%.0fx real time)", scalarTime, seconds / std::max(scalarTime, 1e-9));
+    Console::WriteLine("  mixer:  %.3f seconds (%.0fx real time)", mixTime, seconds / std::max(mixTime, 1e-9));
+    return EXITCODE_OK;
+}
@@ -117,6 +117,8 @@ namespace CommandLine
     extern const CommandLineCommand ScreenshotCommands[];
     extern const CommandLineCommand SpriteCommands[];
     extern const CommandLineCommand BenchGfxCommands[];
+    extern const CommandLineCommand BenchAudioCommands[];
+    extern const CommandLineCommand ReplayCommands[];
 
     extern const CommandLineExample RootExamples[];
 
@@ -0,0 +1,82 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2018 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "../Context.h"
+#include "../Game.h"
+#include "../GameState.h"
+#include "../OpenRCT2.h"
+#include "../ReplayManager.h"
+#include "../core/Console.hpp"
+#include "../core/Path.hpp"
+#include "../platform/platform.h"
+#include "CommandLine.hpp"
+
+#include <chrono>
+
+using namespace OpenRCT2;
+
+static exitcode_t HandleReplay(CommandLineArgEnumerator* argEnumerator);
+
+const CommandLineCommand CommandLine::ReplayCommands[]{
+    // Main commands
+    DefineCommand("", "<file>", nullptr, HandleReplay), CommandTableEnd
+};
+
+static exitcode_t HandleReplay(CommandLineArgEnumerator* argEnumerator)
+{
+    const utf8* rawPath;
+    if (!argEnumerator->TryPopString(&rawPath))
+    {
+        Console::Error::WriteLine("Expected a replay file.");
+        return EXITCODE_FAIL;
+    }
+
+    utf8 path[MAX_PATH];
+    Path::GetAbsolute(path, sizeof(path), rawPath);
+
+    core_init();
+    gOpenRCT2Headless = true;
+
+    auto context = CreateContext();
+    if (!context->Initialise())
+    {
+        Console::Error::WriteLine("Error while initialising OpenRCT2.");
+        return EXITCODE_FAIL;
+    }
+
+    auto replayManager = context->GetReplayManager();
+    if (!replayManager->StartPlayback(path))
+    {
+        Console::Error::WriteLine("Unable to start playback of '%s'.", path);
+        return EXITCODE_FAIL;
+    }
+
+    // Run the logic as fast as possible, there is nothing to render
+    auto gameState = context->GetGameState();
+    uint32_t startTick = gCurrentTicks;
+    auto startTime = std::chrono::high_resolution_clock::now();
+    while (replayManager->IsReplaying())
+    {
+        gameState->UpdateLogic();
+    }
+    std::chrono::duration<double> duration = std::chrono::high_resolution_clock::now() - startTime;
+
+    uint32_t numTicks = gCurrentTicks - startTick;
+    double seconds = duration.count();
+    Console::WriteLine(
+        "Replayed %u ticks in %.3f seconds (%.1f ticks per second).", numTicks, seconds,
+        seconds > 0 ? numTicks / seconds : 0.0);
+
+    if (replayManager->IsPlaybackStateMismatching())
+    {
+        Console::Error::WriteLine("Game state diverged from the recording.");
+        return EXITCODE_FAIL;
+    }
+    return EXITCODE_OK;
+}
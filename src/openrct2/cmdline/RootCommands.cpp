@@ -138,6 +138,8 @@ const CommandLineCommand CommandLine::RootCommands[]
     DefineSubCommand("screenshot", CommandLine::ScreenshotCommands),
     DefineSubCommand("sprite",     CommandLine::SpriteCommands    ),
     DefineSubCommand("benchgfx",   CommandLine::BenchGfxCommands  ),
+    DefineSubCommand("benchaudio", CommandLine::BenchAudioCommands),
+    DefineSubCommand("replay",     CommandLine::ReplayCommands    ),
 
     CommandTableEnd
 };
@@ -7,6 +7,7 @@
  * OpenRCT2 is licensed under the GNU General Public License version 3.
  *****************************************************************************/
 
+#include "../core/Console.hpp"
 #include "../interface/Screenshot.h"
 #include "CommandLine.hpp"
 
@@ -28,12 +29,14 @@ static constexpr const CommandLineOptionDefinition ScreenshotOptionsDef[]
 };
 
 static exitcode_t HandleScreenshot(CommandLineArgEnumerator *argEnumerator);
+static exitcode_t HandleScreenshotBatch(CommandLineArgEnumerator *argEnumerator);
 
 const CommandLineCommand CommandLine::ScreenshotCommands[]
 {
     // Main commands
     DefineCommand("", "<file> <output_image> <width> <height> [<x> <y> <zoom> <rotation>]", ScreenshotOptionsDef, HandleScreenshot),
     DefineCommand("", "<file> <output_image> giant <zoom> <rotation>",                      ScreenshotOptionsDef, HandleScreenshot),
+    DefineCommand("batch", "<manifest>",                                                    ScreenshotOptionsDef, HandleScreenshotBatch),
     CommandTableEnd
 };
 // clang-format on
@@ -49,3 +52,20 @@ static exitcode_t HandleScreenshot(CommandLineArgEnumerator* argEnumerator)
     }
     return EXITCODE_OK;
 }
+
+static exitcode_t HandleScreenshotBatch(CommandLineArgEnumerator* argEnumerator)
+{
+    const utf8* manifestPath;
+    if (!argEnumerator->TryPopString(&manifestPath))
+    {
+        Console::Error::WriteLine("Expected a manifest file.");
+        return EXITCODE_FAIL;
+    }
+
+    int32_t result = cmdline_for_screenshot_batch(manifestPath, &options);
+    if (result < 0)
+    {
+        return EXITCODE_FAIL;
+    }
+    return EXITCODE_OK;
+}
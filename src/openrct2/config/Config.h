@@ -31,6 +31,7 @@ struct GeneralConfiguration
     bool use_vsync;
     bool show_fps;
     bool minimize_fullscreen_focus_loss;
+    bool multithreading;
 
     // Map rendering
     bool landscape_smoothing;
@@ -151,6 +152,7 @@ struct NetworkConfiguration
     bool log_chat;
     bool log_server_actions;
     bool pause_server_if_no_clients;
+    bool send_state_hashes;
 };
 
 struct NotificationConfiguration
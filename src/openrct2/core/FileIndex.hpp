@@ -15,10 +15,14 @@
 #include "FileScanner.h"
 #include "FileStream.hpp"
 #include "JobPool.hpp"
+#include "MemoryMappedFile.h"
+#include "MemoryStream.h"
 #include "Path.hpp"
 
 #include <chrono>
+#include <cstring>
 #include <list>
+#include <stdexcept>
 #include <string>
 #include <tuple>
 #include <vector>
@@ -130,14 +134,48 @@ protected:
     virtual std::tuple<bool, TItem> Create(int32_t language, const std::string& path) const abstract;
 
     /**
-     * Serialises an index item to the given stream.
+     * Serialises an index item to the given stream. Only used by the default WriteItems.
      */
-    virtual void Serialise(IStream* stream, const TItem& item) const abstract;
+    virtual void Serialise([[maybe_unused]] IStream* stream, [[maybe_unused]] const TItem& item) const
+    {
+        throw std::runtime_error("Serialise not implemented.");
+    }
+
+    /**
+     * Deserialises an index item from the given stream. Only used by the default ReadItems.
+     */
+    virtual TItem Deserialise([[maybe_unused]] IStream* stream) const
+    {
+        throw std::runtime_error("Deserialise not implemented.");
+    }
+
+    /**
+     * Writes all the index items that follow the header. Override this together with ReadItems for
+     * a layout other than one serialised item after another.
+     */
+    virtual void WriteItems(IStream* stream, const std::vector<TItem>& items) const
+    {
+        for (const auto& item : items)
+        {
+            Serialise(stream, item);
+        }
+    }
 
     /**
-     * Deserialises an index item from the given stream.
+     * Reads the index items from the data that follows the header, which is mapped directly from
+     * the index file.
      */
-    virtual TItem Deserialise(IStream* stream) const abstract;
+    virtual std::vector<TItem> ReadItems(const uint8_t* data, size_t length, uint32_t numItems) const
+    {
+        std::vector<TItem> items;
+        items.reserve(numItems);
+        auto ms = MemoryStream(data, length);
+        for (uint32_t i = 0; i < numItems; i++)
+        {
+            items.push_back(Deserialise(&ms));
+        }
+        return items;
+    }
 
 private:
     ScanResult Scan() const
@@ -261,23 +299,24 @@ private:
             try
             {
                 log_verbose("FileIndex:Loading index: '%s'", _indexPath.c_str());
-                auto fs = FileStream(_indexPath, FILE_MODE_OPEN);
+                auto file = MemoryMappedFile(_indexPath);
+                if (file.GetLength() < sizeof(FileIndexHeader))
+                {
+                    throw IOException("Index file is truncated.");
+                }
 
                 // Read header, check if we need to re-scan
-                auto header = fs.ReadValue<FileIndexHeader>();
+                FileIndexHeader header;
+                std::memcpy(&header, file.GetData(), sizeof(FileIndexHeader));
                 if (header.HeaderSize == sizeof(FileIndexHeader) && header.MagicNumber == _magicNumber
                     && header.VersionA == FILE_INDEX_VERSION && header.VersionB == _version && header.LanguageId == language
                     && header.Stats.TotalFiles == stats.TotalFiles && header.Stats.TotalFileSize == stats.TotalFileSize
                     && header.Stats.FileDateModifiedChecksum == stats.FileDateModifiedChecksum
                     && header.Stats.PathChecksum == stats.PathChecksum)
                 {
-                    items.reserve(header.NumItems);
                     // Directory is the same, just read the saved items
-                    for (uint32_t i = 0; i < header.NumItems; i++)
-                    {
-                        auto item = Deserialise(&fs);
-                        items.push_back(item);
-                    }
+                    items = ReadItems(
+                        file.GetData() + sizeof(FileIndexHeader), file.GetLength() - sizeof(FileIndexHeader), header.NumItems);
                     loadedItems = true;
                 }
                 else
@@ -313,10 +352,7 @@ private:
             fs.WriteValue(header);
 
             // Write items
-            for (const auto& item : items)
-            {
-                Serialise(&fs, item);
-            }
+            WriteItems(&fs, items);
         }
         catch (const std::exception& e)
         {
@@ -161,7 +161,7 @@ namespace Imaging
         }
     }
 
-    static void WritePng(std::ostream& ostream, const Image& image)
+    static void WritePng(std::ostream& ostream, const Image& image, const ImageRowFunc& getRow)
     {
         png_structp png_ptr = nullptr;
         png_colorp png_palette = nullptr;
@@ -224,11 +224,9 @@ namespace Imaging
             png_write_info(png_ptr, info_ptr);
 
             // Write pixels
-            auto pixels = image.Pixels.data();
             for (uint32_t y = 0; y < image.Height; y++)
             {
-                png_write_row(png_ptr, (png_byte*)pixels);
-                pixels += image.Stride;
+                png_write_row(png_ptr, (png_byte*)getRow(y));
             }
 
             png_write_end(png_ptr, nullptr);
@@ -243,6 +241,11 @@ namespace Imaging
         }
     }
 
+    static void WritePng(std::ostream& ostream, const Image& image)
+    {
+        WritePng(ostream, image, [&image](uint32_t y) { return image.Pixels.data() + (y * image.Stride); });
+    }
+
     IMAGE_FORMAT GetImageFormatFromPath(const std::string_view& path)
     {
         if (String::EndsWith(path, ".png", true))
@@ -343,4 +346,27 @@ namespace Imaging
                 throw std::runtime_error(EXCEPTION_IMAGE_FORMAT_UNKNOWN);
         }
     }
+
+    void WriteToFile(const std::string_view& path, const Image& header, const ImageRowFunc& getRow, IMAGE_FORMAT format)
+    {
+        switch (format)
+        {
+            case IMAGE_FORMAT::AUTOMATIC:
+                WriteToFile(path, header, getRow, GetImageFormatFromPath(path));
+                break;
+            case IMAGE_FORMAT::PNG:
+            {
+#if defined(_WIN32) && !defined(__MINGW32__)
+                auto pathW = String::ToUtf16(path);
+                std::ofstream fs(pathW, std::ios::binary);
+#else
+                std::ofstream fs(path.data(), std::ios::binary);
+#endif
+                WritePng(fs, header, getRow);
+                break;
+            }
+            default:
+                throw std::runtime_error(EXCEPTION_IMAGE_FORMAT_UNKNOWN);
+        }
+    }
 } // namespace Imaging
@@ -52,6 +52,8 @@ struct Image
 };
 
 using ImageReaderFunc = std::function<Image(std::istream&, IMAGE_FORMAT)>;
+// Returns the pixels of the given row, rows are requested once each from top to bottom
+using ImageRowFunc = std::function<const uint8_t*(uint32_t y)>;
 
 namespace Imaging
 {
@@ -60,5 +62,13 @@ namespace Imaging
     Image ReadFromBuffer(const std::vector<uint8_t>& buffer, IMAGE_FORMAT format = IMAGE_FORMAT::AUTOMATIC);
     void WriteToFile(const std::string_view& path, const Image& image, IMAGE_FORMAT format = IMAGE_FORMAT::AUTOMATIC);
 
+    /**
+     * Writes an image whose pixels are produced while it is being encoded, so that it never has to be held in memory as
+     * a whole. Only the dimensions, depth and palette of header are used.
+     */
+    void WriteToFile(
+        const std::string_view& path, const Image& header, const ImageRowFunc& getRow,
+        IMAGE_FORMAT format = IMAGE_FORMAT::AUTOMATIC);
+
     void SetReader(IMAGE_FORMAT format, ImageReaderFunc impl);
 } // namespace Imaging
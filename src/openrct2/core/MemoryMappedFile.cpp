@@ -0,0 +1,116 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2018 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#ifdef _WIN32
+#    define WIN32_LEAN_AND_MEAN
+#    include <windows.h>
+#else
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
+#include "../platform/platform.h"
+#include "IStream.hpp"
+#include "MemoryMappedFile.h"
+#include "String.hpp"
+
+MemoryMappedFile::MemoryMappedFile(const std::string& path)
+{
+#ifdef _WIN32
+    auto pathW = utf8_to_widechar(path.c_str());
+    auto hFile = CreateFileW(pathW, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    free(pathW);
+    if (hFile == INVALID_HANDLE_VALUE)
+    {
+        throw IOException(String::StdFormat("Unable to open '%s'", path.c_str()));
+    }
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(hFile, &fileSize) || (uint64_t)fileSize.QuadPart > SIZE_MAX)
+    {
+        CloseHandle(hFile);
+        throw IOException(String::StdFormat("Unable to get size of '%s'", path.c_str()));
+    }
+    _length = (size_t)fileSize.QuadPart;
+
+    // Mapping an empty file is not allowed
+    if (_length != 0)
+    {
+        _mapping = CreateFileMappingW(hFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (_mapping != nullptr)
+        {
+            _data = (const uint8_t*)MapViewOfFile(_mapping, FILE_MAP_READ, 0, 0, 0);
+        }
+    }
+    CloseHandle(hFile);
+
+    if (_length != 0 && _data == nullptr)
+    {
+        if (_mapping != nullptr)
+        {
+            CloseHandle(_mapping);
+        }
+        throw IOException(String::StdFormat("Unable to map '%s'", path.c_str()));
+    }
+#else
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd == -1)
+    {
+        throw IOException(String::StdFormat("Unable to open '%s'", path.c_str()));
+    }
+
+    struct stat statInfo
+    {
+    };
+    if (fstat(fd, &statInfo) != 0 || (uint64_t)statInfo.st_size > SIZE_MAX)
+    {
+        close(fd);
+        throw IOException(String::StdFormat("Unable to get size of '%s'", path.c_str()));
+    }
+    _length = (size_t)statInfo.st_size;
+
+    // Mapping an empty file is not allowed
+    if (_length != 0)
+    {
+        void* data = mmap(nullptr, _length, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data != MAP_FAILED)
+        {
+            _data = (const uint8_t*)data;
+        }
+    }
+    // The mapping stays valid after the descriptor is closed
+    close(fd);
+
+    if (_length != 0 && _data == nullptr)
+    {
+        throw IOException(String::StdFormat("Unable to map '%s'", path.c_str()));
+    }
+#endif
+}
+
+MemoryMappedFile::~MemoryMappedFile()
+{
+#ifdef _WIN32
+    if (_data != nullptr)
+    {
+        UnmapViewOfFile(_data);
+    }
+    if (_mapping != nullptr)
+    {
+        CloseHandle(_mapping);
+    }
+#else
+    if (_data != nullptr)
+    {
+        munmap((void*)_data, _length);
+    }
+#endif
+}
@@ -0,0 +1,43 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2018 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../common.h"
+
+#include <string>
+
+/**
+ * A read-only view of a whole file mapped into memory. The contents are paged in by the OS as
+ * they are accessed rather than read up front.
+ */
+class MemoryMappedFile final
+{
+private:
+    const uint8_t* _data = nullptr;
+    size_t _length = 0;
+#ifdef _WIN32
+    void* _mapping = nullptr;
+#endif
+
+public:
+    explicit MemoryMappedFile(const std::string& path);
+    MemoryMappedFile(const MemoryMappedFile&) = delete;
+    MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+    ~MemoryMappedFile();
+
+    const uint8_t* GetData() const
+    {
+        return _data;
+    }
+    size_t GetLength() const
+    {
+        return _length;
+    }
+};
@@ -42,6 +42,86 @@ void mask_avx2(
     }
 }
 
+void blit_bmp_avx2(
+    int32_t width, int32_t height, const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t srcWrap, int32_t dstWrap)
+{
+    const __m256i zero = {};
+    for (int32_t yy = 0; yy < height; yy++)
+    {
+        int32_t xx = 0;
+        for (; xx + 32 <= width; xx += 32)
+        {
+            const __m256i colour = _mm256_loadu_si256((const __m256i*)(src + xx));
+            const __m256i transparent = _mm256_cmpeq_epi8(colour, zero);
+            if (_mm256_movemask_epi8(transparent) == -1)
+                continue;
+
+            const __m256i dest = _mm256_loadu_si256((const __m256i*)(dst + xx));
+            _mm256_storeu_si256((__m256i*)(dst + xx), _mm256_blendv_epi8(colour, dest, transparent));
+        }
+        for (; xx < width; xx++)
+        {
+            if (src[xx] != 0)
+            {
+                dst[xx] = src[xx];
+            }
+        }
+        src += width + srcWrap;
+        dst += width + dstWrap;
+    }
+}
+
+void blit_bmp_palette_avx2(
+    int32_t width, int32_t height, const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t srcWrap, int32_t dstWrap,
+    const uint8_t* RESTRICT palette, bool transparent)
+{
+    // There is no vector palette lookup, but whole blocks of transparent pixels can be skipped at once.
+    // Remaps only treat colour 0 as transparent when it maps to 0 as well.
+    if (!transparent && palette[0] != 0)
+    {
+        blit_bmp_palette_scalar(width, height, src, dst, srcWrap, dstWrap, palette, transparent);
+        return;
+    }
+
+    for (int32_t yy = 0; yy < height; yy++)
+    {
+        int32_t xx = 0;
+        for (; xx + 32 <= width; xx += 32)
+        {
+            const __m256i colour = _mm256_loadu_si256((const __m256i*)(src + xx));
+            if (!_mm256_testz_si256(colour, colour))
+            {
+                blit_bmp_palette_row(32, src + xx, dst + xx, palette, transparent);
+            }
+        }
+        blit_bmp_palette_row(width - xx, src + xx, dst + xx, palette, transparent);
+        src += width + srcWrap;
+        dst += width + dstWrap;
+    }
+}
+
+void convert_palette_32_avx2(
+    int32_t width, int32_t height, const uint8_t* RESTRICT src, uint32_t* RESTRICT dst, int32_t srcWrap, int32_t dstWrap,
+    const uint32_t* RESTRICT palette)
+{
+    for (int32_t yy = 0; yy < height; yy++)
+    {
+        int32_t xx = 0;
+        for (; xx + 8 <= width; xx += 8)
+        {
+            const __m256i indices = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)(src + xx)));
+            const __m256i colours = _mm256_i32gather_epi32((const int*)palette, indices, 4);
+            _mm256_storeu_si256((__m256i*)(dst + xx), colours);
+        }
+        for (; xx < width; xx++)
+        {
+            dst[xx] = palette[src[xx]];
+        }
+        src += width + srcWrap;
+        dst += width + dstWrap;
+    }
+}
+
 #else
 
 #    ifdef OPENRCT2_X86
@@ -55,4 +135,24 @@ void mask_avx2(
     openrct2_assert(false, "AVX2 function called on a CPU that doesn't support AVX2");
 }
 
+void blit_bmp_avx2(
+    int32_t width, int32_t height, const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t srcWrap, int32_t dstWrap)
+{
+    openrct2_assert(false, "AVX2 function called on a CPU that doesn't support AVX2");
+}
+
+void blit_bmp_palette_avx2(
+    int32_t width, int32_t height, const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t srcWrap, int32_t dstWrap,
+    const uint8_t* RESTRICT palette, bool transparent)
+{
+    openrct2_assert(false, "AVX2 function called on a CPU that doesn't support AVX2");
+}
+
+void convert_palette_32_avx2(
+    int32_t width, int32_t height, const uint8_t* RESTRICT src, uint32_t* RESTRICT dst, int32_t srcWrap, int32_t dstWrap,
+    const uint32_t* RESTRICT palette)
+{
+    openrct2_assert(false, "AVX2 function called on a CPU that doesn't support AVX2");
+}
+
 #endif // __AVX2__
@@ -20,6 +20,7 @@
 #include "Drawing.h"
 
 #include <algorithm>
+#include <cstring>
 #include <memory>
 #include <stdexcept>
 #include <vector>
@@ -193,6 +194,37 @@ void mask_scalar(
     }
 }
 
+void blit_bmp_scalar(
+    int32_t width, int32_t height, const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t srcWrap, int32_t dstWrap)
+{
+    for (int32_t yy = 0; yy < height; yy++)
+    {
+        for (int32_t xx = 0; xx < width; xx++)
+        {
+            uint8_t pixel = *src++;
+            if (pixel != 0)
+            {
+                *dst = pixel;
+            }
+            dst++;
+        }
+        src += srcWrap;
+        dst += dstWrap;
+    }
+}
+
+void blit_bmp_palette_scalar(
+    int32_t width, int32_t height, const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t srcWrap, int32_t dstWrap,
+    const uint8_t* RESTRICT palette, bool transparent)
+{
+    for (int32_t yy = 0; yy < height; yy++)
+    {
+        blit_bmp_palette_row(width, src, dst, palette, transparent);
+        src += width + srcWrap;
+        dst += width + dstWrap;
+    }
+}
+
 static std::string gfx_get_csg_header_path()
 {
     auto path = Path::ResolveCasing(Path::Combine(gConfigGeneral.rct1_path, "Data", "csg1i.dat"));
@@ -278,6 +310,7 @@ bool gfx_load_g1(const IPlatformEnvironment& env)
 
 void gfx_unload_g1()
 {
+    sprite_mip_cache_clear();
     SafeFree(_g1.data);
     _g1.elements.clear();
     _g1.elements.shrink_to_fit();
@@ -285,6 +318,7 @@ void gfx_unload_g1()
 
 void gfx_unload_g2()
 {
+    sprite_mip_cache_clear();
     SafeFree(_g2.data);
     _g2.elements.clear();
     _g2.elements.shrink_to_fit();
@@ -292,6 +326,7 @@ void gfx_unload_g2()
 
 void gfx_unload_csg()
 {
+    sprite_mip_cache_clear();
     SafeFree(_csg.data);
     _csg.elements.clear();
     _csg.elements.shrink_to_fit();
@@ -411,6 +446,35 @@ void FASTCALL gfx_bmp_sprite_to_buffer(
     uint32_t dest_line_width = (dest_dpi->width / zoom_amount) + dest_dpi->pitch;
     uint32_t source_line_width = source_image->width * zoom_amount;
 
+    if (zoom_level == 0 && width > 0 && height > 0)
+    {
+        // Unzoomed images are drawn a whole row at a time by the vector blitters
+        int32_t srcWrap = source_line_width - width;
+        int32_t dstWrap = dest_line_width - width;
+        if (image_type & IMAGE_TYPE_REMAP)
+        {
+            assert(palette_pointer != nullptr);
+            blit_bmp_palette_fn(width, height, source_pointer, dest_pointer, srcWrap, dstWrap, palette_pointer, false);
+        }
+        else if (image_type & IMAGE_TYPE_TRANSPARENT)
+        {
+            assert(palette_pointer != nullptr);
+            blit_bmp_palette_fn(width, height, source_pointer, dest_pointer, srcWrap, dstWrap, palette_pointer, true);
+        }
+        else if (!(source_image->flags & G1_FLAG_BMP))
+        {
+            for (; height > 0; height--, source_pointer += source_line_width, dest_pointer += dest_line_width)
+            {
+                std::memcpy(dest_pointer, source_pointer, width);
+            }
+        }
+        else
+        {
+            blit_bmp_fn(width, height, source_pointer, dest_pointer, srcWrap, dstWrap);
+        }
+        return;
+    }
+
     // Image uses the palette pointer to remap the colours of the image
     if (image_type & IMAGE_TYPE_REMAP)
     {
@@ -637,6 +701,70 @@ void FASTCALL gfx_draw_sprite_palette_set_software(
         return;
     }
 
+    // Draw a pre-downscaled copy of the image instead of sampling the full resolution image if there is one
+    if (dpi->zoom_level != 0 && gfx_draw_g1_element_mip_software(dpi, image_element, g1, image_type, x, y, palette_pointer))
+    {
+        return;
+    }
+
+    gfx_draw_g1_element_software(dpi, g1, image_type, x, y, palette_pointer);
+}
+
+/**
+ * Draws a zoomed out image from its downscaled copy in the sprite mip cache. The copy is placed and sampled the same way
+ * gfx_draw_g1_element_software samples the full resolution image, so both draw the same pixels. Returns false if there
+ * is no copy for the image or it can not be drawn with the given image type, in which case nothing is drawn.
+ */
+bool gfx_draw_g1_element_mip_software(
+    rct_drawpixelinfo* dpi, int32_t imageId, const rct_g1_element* g1, int32_t image_type, int32_t x, int32_t y,
+    uint8_t* palette_pointer)
+{
+    // The copies are RLE images, the RLE blitter only remaps and blends the same way as the BMP blitter for plain images
+    if (image_type != 0 && !(g1->flags & G1_FLAG_RLE_COMPRESSION))
+    {
+        return false;
+    }
+
+    int32_t zoom_level = dpi->zoom_level;
+    int32_t zoom_mask = 0xFFFFFFFF << zoom_level;
+
+    // The zoomed blitters round the position of the image after adding its offset, not both separately
+    int32_t left = x + g1->x_offset;
+    int32_t top = y + g1->y_offset;
+    int32_t phaseY = 0;
+    if (g1->flags & G1_FLAG_RLE_COMPRESSION)
+    {
+        // RLE images are sampled from the rows that land on the last line of each block of zoomed lines
+        phaseY = (~zoom_mask - top) & ~zoom_mask;
+        left >>= zoom_level;
+        top = (top - ~zoom_mask + phaseY) >> zoom_level;
+    }
+    else
+    {
+        left = (left + ~zoom_mask) >> zoom_level;
+        top >>= zoom_level;
+    }
+
+    auto mip = sprite_mip_cache_get(imageId, zoom_level, phaseY, g1);
+    if (mip == nullptr)
+    {
+        return false;
+    }
+
+    rct_drawpixelinfo zoomed_dpi = *dpi;
+    zoomed_dpi.x >>= zoom_level;
+    zoomed_dpi.y >>= zoom_level;
+    zoomed_dpi.width >>= zoom_level;
+    zoomed_dpi.height >>= zoom_level;
+    zoomed_dpi.zoom_level = 0;
+    gfx_draw_g1_element_software(&zoomed_dpi, mip.get(), image_type, left, top, palette_pointer);
+    return true;
+}
+
+void gfx_draw_g1_element_software(
+    rct_drawpixelinfo* dpi, const rct_g1_element* g1, int32_t image_type, int32_t x, int32_t y, uint8_t* palette_pointer)
+{
+
     // Its used super often so we will define it to a separate variable.
     int32_t zoom_level = dpi->zoom_level;
     int32_t zoom_mask = 0xFFFFFFFF << zoom_level;
@@ -849,6 +977,7 @@ const rct_g1_element* gfx_get_g1_element(int32_t image_id)
         {
             return nullptr;
         }
+        gfx_object_load_deferred_images(image_id);
         return &_g1.elements[image_id];
     }
     if (image_id < SPR_CSG_BEGIN)
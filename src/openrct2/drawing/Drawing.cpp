@@ -38,7 +38,7 @@ int32_t gPickupPeepY;
  * rct2: 0x0009ABE0C
  */
 // clang-format off
-uint8_t gPeepPalette[256] = {
+thread_local uint8_t gPeepPalette[256] = {
     0x00, 0xF3, 0xF4, 0xF5, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F,
     0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F,
     0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F,
@@ -58,7 +58,7 @@ uint8_t gPeepPalette[256] = {
 };
 
 /** rct2: 0x009ABF0C */
-uint8_t gOtherPalette[256] = {
+thread_local uint8_t gOtherPalette[256] = {
     0x00, 0xF3, 0xF4, 0xF5, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F,
     0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F,
     0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F,
@@ -470,22 +470,60 @@ void (*mask_fn)(
     int32_t maskWrap, int32_t colourWrap, int32_t dstWrap)
     = nullptr;
 
+void (*blit_bmp_fn)(
+    int32_t width, int32_t height, const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t srcWrap, int32_t dstWrap)
+    = blit_bmp_scalar;
+
+void (*blit_bmp_palette_fn)(
+    int32_t width, int32_t height, const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t srcWrap, int32_t dstWrap,
+    const uint8_t* RESTRICT palette, bool transparent)
+    = blit_bmp_palette_scalar;
+
+void convert_palette_32_scalar(
+    int32_t width, int32_t height, const uint8_t* RESTRICT src, uint32_t* RESTRICT dst, int32_t srcWrap, int32_t dstWrap,
+    const uint32_t* RESTRICT palette)
+{
+    for (int32_t yy = 0; yy < height; yy++)
+    {
+        for (int32_t xx = 0; xx < width; xx++)
+        {
+            dst[xx] = palette[src[xx]];
+        }
+        src += width + srcWrap;
+        dst += width + dstWrap;
+    }
+}
+
+void (*convert_palette_32_fn)(
+    int32_t width, int32_t height, const uint8_t* RESTRICT src, uint32_t* RESTRICT dst, int32_t srcWrap, int32_t dstWrap,
+    const uint32_t* RESTRICT palette)
+    = convert_palette_32_scalar;
+
 void mask_init()
 {
     if (avx2_available())
     {
-        log_verbose("registering AVX2 mask function");
+        log_verbose("registering AVX2 mask and blit functions");
         mask_fn = mask_avx2;
+        blit_bmp_fn = blit_bmp_avx2;
+        blit_bmp_palette_fn = blit_bmp_palette_avx2;
+        convert_palette_32_fn = convert_palette_32_avx2;
     }
     else if (sse41_available())
     {
-        log_verbose("registering SSE4.1 mask function");
+        log_verbose("registering SSE4.1 mask and blit functions");
         mask_fn = mask_sse4_1;
+        blit_bmp_fn = blit_bmp_sse4_1;
+        blit_bmp_palette_fn = blit_bmp_palette_sse4_1;
+        convert_palette_32_fn = convert_palette_32_scalar;
     }
     else
     {
-        log_verbose("registering scalar mask function");
+        log_verbose("registering scalar mask and blit functions");
         mask_fn = mask_scalar;
+        blit_bmp_fn = blit_bmp_scalar;
+        blit_bmp_palette_fn = blit_bmp_palette_scalar;
+        convert_palette_32_fn = convert_palette_32_scalar;
     }
 }
 
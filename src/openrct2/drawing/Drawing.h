@@ -13,6 +13,9 @@
 #include "../common.h"
 #include "../interface/Colour.h"
 
+#include <functional>
+#include <memory>
+
 namespace OpenRCT2
 {
     interface IPlatformEnvironment;
@@ -245,8 +248,9 @@ extern uint8_t gGamePalette[256 * 4];
 extern uint32_t gPaletteEffectFrame;
 extern const FILTER_PALETTE_ID GlassPaletteIds[COLOUR_COUNT];
 extern const uint16_t palette_to_g1_offset[];
-extern uint8_t gPeepPalette[256];
-extern uint8_t gOtherPalette[256];
+// Per thread as the remap colours are written into them for each sprite drawn
+extern thread_local uint8_t gPeepPalette[256];
+extern thread_local uint8_t gOtherPalette[256];
 extern uint8_t text_palette[];
 extern const translucent_window_palette TranslucentWindowPalettes[COLOUR_COUNT];
 
@@ -301,8 +305,14 @@ const rct_g1_element* gfx_get_g1_element(int32_t image_id);
 void gfx_set_g1_element(int32_t imageId, const rct_g1_element* g1);
 bool is_csg_loaded();
 uint32_t gfx_object_allocate_images(const rct_g1_element* images, uint32_t count);
+uint32_t gfx_object_allocate_images_deferred(uint32_t count, std::function<const rct_g1_element*()> load);
+void gfx_object_load_deferred_images(int32_t imageId);
 void gfx_object_free_images(uint32_t baseImageId, uint32_t count);
 void gfx_object_check_all_images_freed();
+std::shared_ptr<const rct_g1_element> sprite_mip_cache_get(
+    int32_t imageId, int32_t level, int32_t phaseY, const rct_g1_element* source);
+void sprite_mip_cache_invalidate(int32_t imageId);
+void sprite_mip_cache_clear();
 void FASTCALL gfx_bmp_sprite_to_buffer(
     const uint8_t* palette_pointer, uint8_t* source_pointer, uint8_t* dest_pointer, const rct_g1_element* source_image,
     rct_drawpixelinfo* dest_dpi, int32_t height, int32_t width, int32_t image_type);
@@ -320,6 +330,11 @@ void FASTCALL
 uint8_t* FASTCALL gfx_draw_sprite_get_palette(int32_t image_id, uint32_t tertiary_colour);
 void FASTCALL gfx_draw_sprite_palette_set_software(
     rct_drawpixelinfo* dpi, int32_t image_id, int32_t x, int32_t y, uint8_t* palette_pointer, uint8_t* unknown_pointer);
+void gfx_draw_g1_element_software(
+    rct_drawpixelinfo* dpi, const rct_g1_element* g1, int32_t image_type, int32_t x, int32_t y, uint8_t* palette_pointer);
+bool gfx_draw_g1_element_mip_software(
+    rct_drawpixelinfo* dpi, int32_t imageId, const rct_g1_element* g1, int32_t image_type, int32_t x, int32_t y,
+    uint8_t* palette_pointer);
 void FASTCALL
     gfx_draw_sprite_raw_masked_software(rct_drawpixelinfo* dpi, int32_t x, int32_t y, int32_t maskImage, int32_t colourImage);
 
@@ -369,6 +384,12 @@ void ttf_draw_string(rct_drawpixelinfo* dpi, const_utf8string text, int32_t colo
 // scrolling text
 void scrolling_text_initialise_bitmaps();
 void scrolling_text_invalidate();
+/**
+ * Keeps the scrolling text used from now on until scrolling_text_pin_end, so that paint structs that refer to it can
+ * still be drawn after other paint sessions have set up their text.
+ */
+void scrolling_text_pin_begin();
+void scrolling_text_pin_end();
 int32_t scrolling_text_setup(struct paint_session* session, rct_string_id stringId, uint16_t scroll, uint16_t scrollingMode);
 
 rct_size16 FASTCALL gfx_get_sprite_size(uint32_t image_id);
@@ -389,6 +410,65 @@ extern void (*mask_fn)(
     int32_t width, int32_t height, const uint8_t* RESTRICT maskSrc, const uint8_t* RESTRICT colourSrc, uint8_t* RESTRICT dst,
     int32_t maskWrap, int32_t colourWrap, int32_t dstWrap);
 
+// Unzoomed BMP sprite blitters, colour 0 is transparent in the source.
+// The remap variant writes palette[src], the transparent variant writes palette[dst] where src is not 0.
+void blit_bmp_scalar(
+    int32_t width, int32_t height, const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t srcWrap, int32_t dstWrap);
+void blit_bmp_sse4_1(
+    int32_t width, int32_t height, const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t srcWrap, int32_t dstWrap);
+void blit_bmp_avx2(
+    int32_t width, int32_t height, const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t srcWrap, int32_t dstWrap);
+void blit_bmp_palette_scalar(
+    int32_t width, int32_t height, const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t srcWrap, int32_t dstWrap,
+    const uint8_t* RESTRICT palette, bool transparent);
+void blit_bmp_palette_sse4_1(
+    int32_t width, int32_t height, const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t srcWrap, int32_t dstWrap,
+    const uint8_t* RESTRICT palette, bool transparent);
+void blit_bmp_palette_avx2(
+    int32_t width, int32_t height, const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t srcWrap, int32_t dstWrap,
+    const uint8_t* RESTRICT palette, bool transparent);
+
+// Converts 8-bit palette indices to 32-bit colours for presenting the screen. There is no SSE4.1 variant as it lacks a
+// gather instruction.
+void convert_palette_32_scalar(
+    int32_t width, int32_t height, const uint8_t* RESTRICT src, uint32_t* RESTRICT dst, int32_t srcWrap, int32_t dstWrap,
+    const uint32_t* RESTRICT palette);
+void convert_palette_32_avx2(
+    int32_t width, int32_t height, const uint8_t* RESTRICT src, uint32_t* RESTRICT dst, int32_t srcWrap, int32_t dstWrap,
+    const uint32_t* RESTRICT palette);
+
+inline void blit_bmp_palette_row(
+    int32_t width, const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, const uint8_t* RESTRICT palette, bool transparent)
+{
+    for (int32_t xx = 0; xx < width; xx++)
+    {
+        if (transparent)
+        {
+            if (src[xx] != 0)
+            {
+                dst[xx] = palette[dst[xx]];
+            }
+        }
+        else
+        {
+            uint8_t pixel = palette[src[xx]];
+            if (pixel != 0)
+            {
+                dst[xx] = pixel;
+            }
+        }
+    }
+}
+
+extern void (*blit_bmp_fn)(
+    int32_t width, int32_t height, const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t srcWrap, int32_t dstWrap);
+extern void (*blit_bmp_palette_fn)(
+    int32_t width, int32_t height, const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t srcWrap, int32_t dstWrap,
+    const uint8_t* RESTRICT palette, bool transparent);
+extern void (*convert_palette_32_fn)(
+    int32_t width, int32_t height, const uint8_t* RESTRICT src, uint32_t* RESTRICT dst, int32_t srcWrap, int32_t dstWrap,
+    const uint32_t* RESTRICT palette);
+
 #include "NewDrawing.h"
 
 #endif
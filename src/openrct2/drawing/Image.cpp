@@ -13,7 +13,10 @@
 #include "Drawing.h"
 
 #include <algorithm>
+#include <atomic>
 #include <list>
+#include <map>
+#include <mutex>
 
 constexpr uint32_t BASE_IMAGE_ID = 29294;
 constexpr uint32_t MAX_IMAGES = 262144;
@@ -25,10 +28,21 @@ struct ImageList
     uint32_t Count;
 };
 
+struct DeferredImageList
+{
+    uint32_t Count;
+    std::function<const rct_g1_element*()> Load;
+};
+
 static bool _initialised = false;
 static std::list<ImageList> _freeLists;
 static uint32_t _allocatedImageCount;
 
+// Image lists whose elements are only set the first time one of their images is requested, by base image id
+static std::map<uint32_t, DeferredImageList> _deferredLists;
+static std::atomic<bool> _deferredImages[MAX_IMAGES];
+static std::recursive_mutex _deferredMutex;
+
 #ifdef DEBUG
 static std::list<ImageList> _allocatedLists;
 
@@ -211,10 +225,88 @@ uint32_t gfx_object_allocate_images(const rct_g1_element* images, uint32_t count
     return baseImageId;
 }
 
+/**
+ * Allocates images for an object without setting their elements yet. The load function is called the first time any of
+ * the images is requested, possibly from a drawing thread, and has to return the elements for all of them.
+ */
+uint32_t gfx_object_allocate_images_deferred(uint32_t count, std::function<const rct_g1_element*()> load)
+{
+    if (count == 0 || gOpenRCT2NoGraphics)
+    {
+        return INVALID_IMAGE_ID;
+    }
+
+    uint32_t baseImageId = AllocateImageList(count);
+    if (baseImageId == INVALID_IMAGE_ID)
+    {
+        log_error("Reached maximum image limit.");
+        return INVALID_IMAGE_ID;
+    }
+
+    std::lock_guard<std::recursive_mutex> lock(_deferredMutex);
+    _deferredLists[baseImageId] = { count, std::move(load) };
+    rct_g1_element g1 = {};
+    for (uint32_t i = 0; i < count; i++)
+    {
+        uint32_t imageId = baseImageId + i;
+        gfx_set_g1_element(imageId, &g1);
+        drawing_engine_invalidate_image(imageId);
+        _deferredImages[imageId - BASE_IMAGE_ID].store(true, std::memory_order_release);
+    }
+
+    return baseImageId;
+}
+
+void gfx_object_load_deferred_images(int32_t imageId)
+{
+    if (imageId < (int32_t)BASE_IMAGE_ID || imageId >= (int32_t)(BASE_IMAGE_ID + MAX_IMAGES))
+    {
+        return;
+    }
+    if (!_deferredImages[imageId - BASE_IMAGE_ID].load(std::memory_order_acquire))
+    {
+        return;
+    }
+
+    std::lock_guard<std::recursive_mutex> lock(_deferredMutex);
+    auto it = _deferredLists.upper_bound((uint32_t)imageId);
+    if (it == _deferredLists.begin())
+    {
+        // Already loaded by another thread
+        return;
+    }
+    it--;
+    uint32_t baseImageId = it->first;
+    if ((uint32_t)imageId >= baseImageId + it->second.Count)
+    {
+        return;
+    }
+
+    // Remove the list before loading it, so that a load requesting its own images does not recurse
+    auto list = std::move(it->second);
+    _deferredLists.erase(it);
+
+    auto images = list.Load();
+    for (uint32_t i = 0; i < list.Count; i++)
+    {
+        gfx_set_g1_element(baseImageId + i, &images[i]);
+        _deferredImages[baseImageId + i - BASE_IMAGE_ID].store(false, std::memory_order_release);
+    }
+}
+
 void gfx_object_free_images(uint32_t baseImageId, uint32_t count)
 {
     if (baseImageId != 0 && baseImageId != INVALID_IMAGE_ID)
     {
+        {
+            std::lock_guard<std::recursive_mutex> lock(_deferredMutex);
+            _deferredLists.erase(baseImageId);
+            for (uint32_t i = 0; i < count; i++)
+            {
+                _deferredImages[baseImageId + i - BASE_IMAGE_ID].store(false, std::memory_order_release);
+            }
+        }
+
         // Zero the G1 elements so we don't have invalid pointers
         // and data lying about
         for (uint32_t i = 0; i < count; i++)
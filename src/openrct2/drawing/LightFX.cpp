@@ -14,6 +14,7 @@
 #    include "../Game.h"
 #    include "../common.h"
 #    include "../config/Config.h"
+#    include "../core/JobPool.hpp"
 #    include "../interface/Viewport.h"
 #    include "../interface/Window.h"
 #    include "../ride/Ride.h"
@@ -26,6 +27,16 @@
 #    include <algorithm>
 #    include <cmath>
 #    include <cstring>
+#    include <memory>
+#    include <vector>
+
+#    if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#        define LIGHTFX_SSE2
+#        include <emmintrin.h>
+#    endif
+
+// Number of rows handled by one task when the lights are accumulated and blended on multiple threads
+constexpr uint32_t LIGHTFX_BAND_HEIGHT = 64;
 
 static uint8_t _bakedLightTexture_lantern_0[32 * 32];
 static uint8_t _bakedLightTexture_lantern_1[64 * 64];
@@ -76,6 +87,27 @@ static uint8_t _current_view_zoom_back_delay = 0;
 
 static rct_palette gPalette_light;
 
+// Part of a baked light texture that is added to the light buffer, already clipped to the screen
+struct lightfx_blit
+{
+    const uint8_t* src;
+    uint32_t srcPitch;
+    int32_t x, y;
+    int32_t width, height;
+    uint8_t intensity;
+};
+
+static std::vector<lightfx_blit> _lightBlits;
+static std::unique_ptr<JobPool> _lightJobPool;
+
+// The lights and view the front buffer was last rendered for, so it can be reused when nothing has changed
+static std::vector<lightlist_entry> _renderedLightList;
+static int16_t _rendered_view_x = 0;
+static int16_t _rendered_view_y = 0;
+static uint8_t _rendered_view_zoom = 0;
+static uint32_t _renderedLightPolution = 0;
+static bool _renderedLightListValid = false;
+
 static uint8_t calc_light_intensity_lantern(int32_t x, int32_t y)
 {
     double distance = (double)(x * x + y * y);
@@ -172,6 +204,30 @@ void lightfx_update_buffers(rct_drawpixelinfo* info)
     _light_rendered_buffer_back = realloc(_light_rendered_buffer_back, info->width * info->height);
 
     memcpy(&_pixelInfo, info, sizeof(rct_drawpixelinfo));
+    _renderedLightListValid = false;
+}
+
+/**
+ * Calls fn for horizontal bands of the given height that together cover all rows, on multiple threads if enabled.
+ */
+template<typename TFunc> static void lightfx_for_each_band(uint32_t height, TFunc fn)
+{
+    if (!gConfigGeneral.multithreading || height <= LIGHTFX_BAND_HEIGHT)
+    {
+        fn(0, height);
+        return;
+    }
+
+    if (_lightJobPool == nullptr)
+    {
+        _lightJobPool = std::make_unique<JobPool>();
+    }
+    for (uint32_t top = 0; top < height; top += LIGHTFX_BAND_HEIGHT)
+    {
+        uint32_t bottom = std::min(height, top + LIGHTFX_BAND_HEIGHT);
+        _lightJobPool->AddTask([&fn, top, bottom]() -> void { fn(top, bottom); });
+    }
+    _lightJobPool->Join();
 }
 
 extern void viewport_paint_setup();
@@ -493,6 +549,71 @@ void lightfx_update_viewport_settings()
     }
 }
 
+static void lightfx_add_light_pixels(uint8_t* dst, const uint8_t* src, int32_t x, int32_t width, uint8_t intensity)
+{
+    if (intensity == 0xFF)
+    {
+        for (; x < width; x++)
+        {
+            dst[x] = std::min(0xFF, dst[x] + src[x]);
+        }
+    }
+    else
+    {
+        for (; x < width; x++)
+        {
+            dst[x] = std::min(0xFF, dst[x] + ((src[x] * (1 + intensity)) >> 8));
+        }
+    }
+}
+
+void lightfx_add_light_row_scalar(uint8_t* dst, const uint8_t* src, int32_t width, uint8_t intensity)
+{
+    lightfx_add_light_pixels(dst, src, 0, width, intensity);
+}
+
+/**
+ * Adds a row of a light texture on to a row of the light buffer, scaled by the intensity unless it is at full intensity.
+ */
+void lightfx_add_light_row(uint8_t* dst, const uint8_t* src, int32_t width, uint8_t intensity)
+{
+    int32_t x = 0;
+#    ifdef LIGHTFX_SSE2
+    if (intensity == 0xFF)
+    {
+        for (; x + 16 <= width; x += 16)
+        {
+            __m128i light = _mm_loadu_si128((const __m128i*)&src[x]);
+            __m128i sum = _mm_adds_epu8(_mm_loadu_si128((const __m128i*)&dst[x]), light);
+            _mm_storeu_si128((__m128i*)&dst[x], sum);
+        }
+    }
+    else
+    {
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i scale = _mm_set1_epi16(1 + intensity);
+        for (; x + 16 <= width; x += 16)
+        {
+            __m128i light = _mm_loadu_si128((const __m128i*)&src[x]);
+            __m128i lightLo = _mm_srli_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(light, zero), scale), 8);
+            __m128i lightHi = _mm_srli_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(light, zero), scale), 8);
+            __m128i sum = _mm_adds_epu8(_mm_loadu_si128((const __m128i*)&dst[x]), _mm_packus_epi16(lightLo, lightHi));
+            _mm_storeu_si128((__m128i*)&dst[x], sum);
+        }
+    }
+#    endif
+    lightfx_add_light_pixels(dst, src, x, width, intensity);
+}
+
+static bool lightfx_is_light_list_unchanged()
+{
+    return _renderedLightListValid && _rendered_view_x == _current_view_x_front && _rendered_view_y == _current_view_y_front
+        && _rendered_view_zoom == _current_view_zoom_front && _renderedLightList.size() == LightListCurrentCountFront
+        && (LightListCurrentCountFront == 0
+            || std::memcmp(_renderedLightList.data(), _LightListFront, LightListCurrentCountFront * sizeof(lightlist_entry))
+                == 0);
+}
+
 void lightfx_render_lights_to_frontbuffer()
 {
     if (_light_rendered_buffer_front == nullptr)
@@ -500,20 +621,24 @@ void lightfx_render_lights_to_frontbuffer()
         return;
     }
 
-    memset(_light_rendered_buffer_front, 0, _pixelInfo.width * _pixelInfo.height);
+    // Nothing needs to be drawn if the lights are the same as those already in the buffer, e.g. for a still view at night
+    if (lightfx_is_light_list_unchanged())
+    {
+        _lightPolution_back = _renderedLightPolution;
+        return;
+    }
 
     _lightPolution_back = 0;
+    _lightBlits.clear();
 
     //  log_warning("%i lights", LightListCurrentCountFront);
 
     for (uint32_t light = 0; light < LightListCurrentCountFront; light++)
     {
         const uint8_t* bufReadBase = nullptr;
-        uint8_t* bufWriteBase = (uint8_t*)_light_rendered_buffer_front;
         uint32_t bufReadWidth, bufReadHeight;
         int32_t bufWriteX, bufWriteY;
         int32_t bufWriteWidth, bufWriteHeight;
-        uint32_t bufReadSkip, bufWriteSkip;
 
         lightlist_entry* entry = &_LightListFront[light];
 
@@ -584,10 +709,7 @@ void lightfx_render_lights_to_frontbuffer()
         {
             bufReadBase += -bufWriteX;
             bufWriteWidth += bufWriteX;
-        }
-        else
-        {
-            bufWriteBase += bufWriteX;
+            bufWriteX = 0;
         }
 
         if (bufWriteWidth <= 0)
@@ -597,10 +719,7 @@ void lightfx_render_lights_to_frontbuffer()
         {
             bufReadBase += -bufWriteY * bufReadWidth;
             bufWriteHeight += bufWriteY;
-        }
-        else
-        {
-            bufWriteBase += bufWriteY * _pixelInfo.width;
+            bufWriteY = 0;
         }
 
         if (bufWriteHeight <= 0)
@@ -625,40 +744,34 @@ void lightfx_render_lights_to_frontbuffer()
 
         _lightPolution_back += (bufWriteWidth * bufWriteHeight) / 256;
 
-        bufReadSkip = bufReadWidth - bufWriteWidth;
-        bufWriteSkip = _pixelInfo.width - bufWriteWidth;
+        _lightBlits.push_back({ bufReadBase, bufReadWidth, bufWriteX, bufWriteY, bufWriteWidth, bufWriteHeight,
+                                entry->lightIntensity });
+    }
 
-        if (entry->lightIntensity == 0xFF)
+    // Every band only writes to its own rows of the light buffer
+    uint8_t* lightBits = (uint8_t*)_light_rendered_buffer_front;
+    const int32_t pitch = _pixelInfo.width;
+    lightfx_for_each_band(_pixelInfo.height, [lightBits, pitch](uint32_t top, uint32_t bottom) -> void {
+        std::fill_n(lightBits + top * pitch, (bottom - top) * pitch, 0);
+        for (const auto& blit : _lightBlits)
         {
-            for (int32_t y = 0; y < bufWriteHeight; y++)
+            int32_t y = std::max<int32_t>(blit.y, top);
+            int32_t yEnd = std::min<int32_t>(blit.y + blit.height, bottom);
+            for (; y < yEnd; y++)
             {
-                for (int32_t x = 0; x < bufWriteWidth; x++)
-                {
-                    *bufWriteBase = std::min(0xFF, *bufWriteBase + *bufReadBase);
-                    bufWriteBase++;
-                    bufReadBase++;
-                }
-
-                bufWriteBase += bufWriteSkip;
-                bufReadBase += bufReadSkip;
+                uint8_t* dst = lightBits + y * pitch + blit.x;
+                const uint8_t* src = blit.src + (y - blit.y) * blit.srcPitch;
+                lightfx_add_light_row(dst, src, blit.width, blit.intensity);
             }
         }
-        else
-        {
-            for (int32_t y = 0; y < bufWriteHeight; y++)
-            {
-                for (int32_t x = 0; x < bufWriteWidth; x++)
-                {
-                    *bufWriteBase = std::min(0xFF, *bufWriteBase + (((*bufReadBase) * (1 + entry->lightIntensity)) >> 8));
-                    bufWriteBase++;
-                    bufReadBase++;
-                }
-
-                bufWriteBase += bufWriteSkip;
-                bufReadBase += bufReadSkip;
-            }
-        }
-    }
+    });
+
+    _renderedLightList.assign(_LightListFront, _LightListFront + LightListCurrentCountFront);
+    _rendered_view_x = _current_view_x_front;
+    _rendered_view_y = _current_view_y_front;
+    _rendered_view_zoom = _current_view_zoom_front;
+    _renderedLightPolution = _lightPolution_back;
+    _renderedLightListValid = true;
 }
 
 void* lightfx_get_front_buffer()
@@ -1078,6 +1191,80 @@ static uint8_t mix_light(uint32_t a, uint32_t b, uint32_t intensity)
     return result;
 }
 
+static void lightfx_blend_pixels(
+    uint32_t* dst, const uint8_t* bits, const uint8_t* lightBits, uint32_t x, uint32_t width, const uint32_t* palette,
+    const uint32_t* lightPalette)
+{
+    for (; x < width; x++)
+    {
+        uint32_t darkColour = palette[bits[x]];
+        uint32_t lightColour = lightPalette[bits[x]];
+        uint8_t lightIntensity = lightBits[x];
+
+        uint32_t colour = 0;
+        if (lightIntensity == 0)
+        {
+            colour = darkColour;
+        }
+        else
+        {
+            colour |= mix_light((darkColour >> 0) & 0xFF, (lightColour >> 0) & 0xFF, lightIntensity);
+            colour |= mix_light((darkColour >> 8) & 0xFF, (lightColour >> 8) & 0xFF, lightIntensity) << 8;
+            colour |= mix_light((darkColour >> 16) & 0xFF, (lightColour >> 16) & 0xFF, lightIntensity) << 16;
+            colour |= mix_light((darkColour >> 24) & 0xFF, (lightColour >> 24) & 0xFF, lightIntensity) << 24;
+        }
+        dst[x] = colour;
+    }
+}
+
+void lightfx_blend_row_scalar(
+    uint32_t* dst, const uint8_t* bits, const uint8_t* lightBits, uint32_t width, const uint32_t* palette,
+    const uint32_t* lightPalette)
+{
+    lightfx_blend_pixels(dst, bits, lightBits, 0, width, palette, lightPalette);
+}
+
+/**
+ * Converts a row of the rendered image to 32-bit colours, adding the light colour of every pixel by its light intensity.
+ */
+void lightfx_blend_row(
+    uint32_t* dst, const uint8_t* bits, const uint8_t* lightBits, uint32_t width, const uint32_t* palette,
+    const uint32_t* lightPalette)
+{
+    uint32_t x = 0;
+#    ifdef LIGHTFX_SSE2
+    // Four pixels at a time, using 16-bit lanes so (light * intensity * 6) >> 8 can be done as a high multiply of light << 8
+    const __m128i zero = _mm_setzero_si128();
+    for (; x + 4 <= width; x += 4)
+    {
+        __m128i dark = _mm_setr_epi32(palette[bits[x]], palette[bits[x + 1]], palette[bits[x + 2]], palette[bits[x + 3]]);
+        uint32_t intensities;
+        std::memcpy(&intensities, &lightBits[x], sizeof(intensities));
+        if (intensities == 0)
+        {
+            _mm_storeu_si128((__m128i*)&dst[x], dark);
+            continue;
+        }
+
+        __m128i light = _mm_setr_epi32(
+            lightPalette[bits[x]], lightPalette[bits[x + 1]], lightPalette[bits[x + 2]], lightPalette[bits[x + 3]]);
+        int16_t i0 = lightBits[x] * 6;
+        int16_t i1 = lightBits[x + 1] * 6;
+        int16_t i2 = lightBits[x + 2] * 6;
+        int16_t i3 = lightBits[x + 3] * 6;
+        __m128i intensityLo = _mm_setr_epi16(i0, i0, i0, i0, i1, i1, i1, i1);
+        __m128i intensityHi = _mm_setr_epi16(i2, i2, i2, i2, i3, i3, i3, i3);
+
+        __m128i lo = _mm_add_epi16(
+            _mm_unpacklo_epi8(dark, zero), _mm_mulhi_epu16(_mm_unpacklo_epi8(zero, light), intensityLo));
+        __m128i hi = _mm_add_epi16(
+            _mm_unpackhi_epi8(dark, zero), _mm_mulhi_epu16(_mm_unpackhi_epi8(zero, light), intensityHi));
+        _mm_storeu_si128((__m128i*)&dst[x], _mm_packus_epi16(lo, hi));
+    }
+#    endif
+    lightfx_blend_pixels(dst, bits, lightBits, x, width, palette, lightPalette);
+}
+
 void lightfx_render_to_texture(
     void* dstPixels, uint32_t dstPitch, uint8_t* bits, uint32_t width, uint32_t height, const uint32_t* palette,
     const uint32_t* lightPalette)
@@ -1093,32 +1280,13 @@ void lightfx_render_to_texture(
         return;
     }
 
-    for (uint32_t y = 0; y < height; y++)
-    {
-        uintptr_t dstOffset = (uintptr_t)(y * dstPitch);
-        uint32_t* dst = (uint32_t*)((uintptr_t)dstPixels + dstOffset);
-        for (uint32_t x = 0; x < width; x++)
+    lightfx_for_each_band(height, [=](uint32_t top, uint32_t bottom) -> void {
+        for (uint32_t y = top; y < bottom; y++)
         {
-            uint8_t* src = &bits[y * width + x];
-            uint32_t darkColour = palette[*src];
-            uint32_t lightColour = lightPalette[*src];
-            uint8_t lightIntensity = lightBits[y * width + x];
-
-            uint32_t colour = 0;
-            if (lightIntensity == 0)
-            {
-                colour = darkColour;
-            }
-            else
-            {
-                colour |= mix_light((darkColour >> 0) & 0xFF, (lightColour >> 0) & 0xFF, lightIntensity);
-                colour |= mix_light((darkColour >> 8) & 0xFF, (lightColour >> 8) & 0xFF, lightIntensity) << 8;
-                colour |= mix_light((darkColour >> 16) & 0xFF, (lightColour >> 16) & 0xFF, lightIntensity) << 16;
-                colour |= mix_light((darkColour >> 24) & 0xFF, (lightColour >> 24) & 0xFF, lightIntensity) << 24;
-            }
-            *dst++ = colour;
+            uint32_t* dst = (uint32_t*)((uintptr_t)dstPixels + (uintptr_t)(y * dstPitch));
+            lightfx_blend_row(dst, &bits[y * width], &lightBits[y * width], width, palette, lightPalette);
         }
-    }
+    });
 }
 
 #endif // __ENABLE_LIGHTFX__
@@ -71,6 +71,17 @@ void lightfx_render_to_texture(
     void* dstPixels, uint32_t dstPitch, uint8_t* bits, uint32_t width, uint32_t height, const uint32_t* palette,
     const uint32_t* lightPalette);
 
+// Row functions used by lightfx_render_lights_to_frontbuffer and lightfx_render_to_texture, using SSE2 where available.
+// The scalar variants give the results the vector paths have to match.
+void lightfx_add_light_row(uint8_t* dst, const uint8_t* src, int32_t width, uint8_t intensity);
+void lightfx_add_light_row_scalar(uint8_t* dst, const uint8_t* src, int32_t width, uint8_t intensity);
+void lightfx_blend_row(
+    uint32_t* dst, const uint8_t* bits, const uint8_t* lightBits, uint32_t width, const uint32_t* palette,
+    const uint32_t* lightPalette);
+void lightfx_blend_row_scalar(
+    uint32_t* dst, const uint8_t* bits, const uint8_t* lightBits, uint32_t width, const uint32_t* palette,
+    const uint32_t* lightPalette);
+
 #endif // __ENABLE_LIGHTFX__
 
 #endif
@@ -137,8 +137,21 @@ bool drawing_engine_has_dirty_optimisations()
     return result;
 }
 
+bool drawing_engine_supports_parallel_drawing()
+{
+    bool result = false;
+    auto drawingEngine = GetDrawingEngine();
+    if (drawingEngine != nullptr)
+    {
+        result = (drawingEngine->GetFlags() & DEF_PARALLEL_DRAWING);
+    }
+    return result;
+}
+
 void drawing_engine_invalidate_image(uint32_t image)
 {
+    sprite_mip_cache_invalidate(image);
+
     auto drawingEngine = GetDrawingEngine();
     if (drawingEngine != nullptr)
     {
@@ -26,5 +26,6 @@ void drawing_engine_dispose();
 
 rct_drawpixelinfo* drawing_engine_get_dpi();
 bool drawing_engine_has_dirty_optimisations();
+bool drawing_engine_supports_parallel_drawing();
 void drawing_engine_invalidate_image(uint32_t image);
 void drawing_engine_set_vsync(bool vsync);
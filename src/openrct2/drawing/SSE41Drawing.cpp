@@ -56,6 +56,64 @@ void mask_sse4_1(
     }
 }
 
+void blit_bmp_sse4_1(
+    int32_t width, int32_t height, const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t srcWrap, int32_t dstWrap)
+{
+    const __m128i zero = {};
+    for (int32_t yy = 0; yy < height; yy++)
+    {
+        int32_t xx = 0;
+        for (; xx + 16 <= width; xx += 16)
+        {
+            const __m128i colour = _mm_loadu_si128((const __m128i*)(src + xx));
+            const __m128i transparent = _mm_cmpeq_epi8(colour, zero);
+            if (_mm_movemask_epi8(transparent) == 0xFFFF)
+                continue;
+
+            const __m128i dest = _mm_loadu_si128((const __m128i*)(dst + xx));
+            _mm_storeu_si128((__m128i*)(dst + xx), _mm_blendv_epi8(colour, dest, transparent));
+        }
+        for (; xx < width; xx++)
+        {
+            if (src[xx] != 0)
+            {
+                dst[xx] = src[xx];
+            }
+        }
+        src += width + srcWrap;
+        dst += width + dstWrap;
+    }
+}
+
+void blit_bmp_palette_sse4_1(
+    int32_t width, int32_t height, const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t srcWrap, int32_t dstWrap,
+    const uint8_t* RESTRICT palette, bool transparent)
+{
+    // There is no vector palette lookup, but whole blocks of transparent pixels can be skipped at once.
+    // Remaps only treat colour 0 as transparent when it maps to 0 as well.
+    if (!transparent && palette[0] != 0)
+    {
+        blit_bmp_palette_scalar(width, height, src, dst, srcWrap, dstWrap, palette, transparent);
+        return;
+    }
+
+    for (int32_t yy = 0; yy < height; yy++)
+    {
+        int32_t xx = 0;
+        for (; xx + 16 <= width; xx += 16)
+        {
+            const __m128i colour = _mm_loadu_si128((const __m128i*)(src + xx));
+            if (!_mm_testz_si128(colour, colour))
+            {
+                blit_bmp_palette_row(16, src + xx, dst + xx, palette, transparent);
+            }
+        }
+        blit_bmp_palette_row(width - xx, src + xx, dst + xx, palette, transparent);
+        src += width + srcWrap;
+        dst += width + dstWrap;
+    }
+}
+
 #else
 
 #    ifdef OPENRCT2_X86
@@ -69,4 +127,17 @@ void mask_sse4_1(
     openrct2_assert(false, "SSE 4.1 function called on a CPU that doesn't support SSE 4.1");
 }
 
+void blit_bmp_sse4_1(
+    int32_t width, int32_t height, const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t srcWrap, int32_t dstWrap)
+{
+    openrct2_assert(false, "SSE 4.1 function called on a CPU that doesn't support SSE 4.1");
+}
+
+void blit_bmp_palette_sse4_1(
+    int32_t width, int32_t height, const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t srcWrap, int32_t dstWrap,
+    const uint8_t* RESTRICT palette, bool transparent)
+{
+    openrct2_assert(false, "SSE 4.1 function called on a CPU that doesn't support SSE 4.1");
+}
+
 #endif // __SSE4_1__
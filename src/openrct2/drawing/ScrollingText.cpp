@@ -38,6 +38,8 @@ assert_struct_size(rct_draw_scroll_text, 0xA12);
 static rct_draw_scroll_text _drawScrollTextList[MAX_SCROLLING_TEXT_ENTRIES];
 static uint8_t _characterBitmaps[FONT_SPRITE_GLYPH_COUNT + SPR_G2_GLYPH_COUNT][8];
 static uint32_t _drawSCrollNextIndex = 0;
+// Entries with an id from this one onwards have been used since pinning started and must not be replaced
+static uint32_t _drawScrollPinnedId = UINT32_MAX;
 
 static void scrolling_text_set_bitmap_for_sprite(
     utf8* text, int32_t scroll, uint8_t* bitmap, const int16_t* scrollPositionOffsets);
@@ -140,7 +142,7 @@ static int32_t scrolling_text_get_matching_or_oldest(rct_string_id stringId, uin
     for (int32_t i = 0; i < MAX_SCROLLING_TEXT_ENTRIES; i++)
     {
         rct_draw_scroll_text* scrollText = &_drawScrollTextList[i];
-        if (oldestId >= scrollText->id)
+        if (oldestId >= scrollText->id && scrollText->id < _drawScrollPinnedId)
         {
             oldestId = scrollText->id;
             scrollIndex = i;
@@ -157,6 +159,10 @@ static int32_t scrolling_text_get_matching_or_oldest(rct_string_id stringId, uin
             return i + SPR_SCROLLING_TEXT_START;
         }
     }
+
+    // Every entry is pinned, there is no room for any more text
+    if (scrollIndex == -1)
+        return SPR_SCROLLING_TEXT_DEFAULT;
     return scrollIndex;
 }
 
@@ -1451,6 +1457,16 @@ static constexpr const int16_t* _scrollPositions[MAX_SCROLLING_TEXT_MODES] = {
 };
 // clang-format on
 
+void scrolling_text_pin_begin()
+{
+    _drawScrollPinnedId = _drawSCrollNextIndex + 1;
+}
+
+void scrolling_text_pin_end()
+{
+    _drawScrollPinnedId = UINT32_MAX;
+}
+
 void scrolling_text_invalidate()
 {
     for (int32_t i = 0; i < MAX_SCROLLING_TEXT_ENTRIES; i++)
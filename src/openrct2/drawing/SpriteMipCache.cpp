@@ -0,0 +1,303 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2018 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "../sprites.h"
+#include "Drawing.h"
+
+#include <algorithm>
+#include <iterator>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+// Upper bound on the memory held by downscaled sprites, enough for every sprite of a busy park at all zoom levels
+constexpr size_t SPRITE_MIP_CACHE_MAX_BYTES = 32 * 1024 * 1024;
+constexpr int32_t SPRITE_MIP_MAX_LEVEL = 3;
+
+struct SpriteMipEntry
+{
+    uint32_t Key;
+    // Copy of the element the mip was built from, used to detect images that have been replaced
+    rct_g1_element Source;
+    rct_g1_element Element;
+    std::vector<uint8_t> Data;
+};
+
+// Entries are shared with the callers so that one evicted by another drawing thread stays valid until it has been drawn
+static std::list<std::shared_ptr<SpriteMipEntry>> _mipEntries;
+static std::unordered_map<uint32_t, std::list<std::shared_ptr<SpriteMipEntry>>::iterator> _mipLookup;
+static size_t _mipBytes;
+static std::mutex _mipMutex;
+
+static uint32_t sprite_mip_get_key(int32_t imageId, int32_t level, int32_t phaseY)
+{
+    return ((uint32_t)imageId << 5) | ((uint32_t)(level - 1) << 3) | (uint32_t)phaseY;
+}
+
+static bool sprite_mip_is_same_element(const rct_g1_element& a, const rct_g1_element& b)
+{
+    return a.offset == b.offset && a.width == b.width && a.height == b.height && a.x_offset == b.x_offset
+        && a.y_offset == b.y_offset && a.flags == b.flags;
+}
+
+static void sprite_mip_remove(std::list<std::shared_ptr<SpriteMipEntry>>::iterator it)
+{
+    _mipBytes -= (*it)->Data.size();
+    _mipLookup.erase((*it)->Key);
+    _mipEntries.erase(it);
+}
+
+/**
+ * Expands a BMP or RLE element into one byte per pixel plus a coverage mask.
+ */
+static bool sprite_mip_decode(const rct_g1_element& g1, std::vector<uint8_t>& pixels, std::vector<uint8_t>& mask)
+{
+    const int32_t width = g1.width;
+    const int32_t height = g1.height;
+    pixels.assign(width * height, 0);
+    mask.assign(width * height, 0);
+
+    if (g1.flags & G1_FLAG_RLE_COMPRESSION)
+    {
+        const uint8_t* src = g1.offset;
+        for (int32_t y = 0; y < height; y++)
+        {
+            const uint8_t* lineData = src + ((const uint16_t*)src)[y];
+            uint8_t isEndOfLine = 0;
+            while (!isEndOfLine)
+            {
+                uint8_t dataSize = *lineData++;
+                uint8_t firstPixelX = *lineData++;
+                isEndOfLine = dataSize & 0x80;
+                dataSize &= 0x7F;
+                if (firstPixelX + dataSize > width)
+                {
+                    return false;
+                }
+
+                size_t index = y * width + firstPixelX;
+                std::copy_n(lineData, dataSize, pixels.begin() + index);
+                std::fill_n(mask.begin() + index, dataSize, 1);
+                lineData += dataSize;
+            }
+        }
+    }
+    else
+    {
+        // Raw images only treat palette index 0 as transparent when flagged as such
+        bool transparentZero = (g1.flags & G1_FLAG_BMP) != 0;
+        std::copy_n(g1.offset, pixels.size(), pixels.begin());
+        for (size_t i = 0; i < pixels.size(); i++)
+        {
+            mask[i] = !transparentZero || pixels[i] != 0;
+        }
+    }
+    return true;
+}
+
+/**
+ * Encodes the pixels in the same run length format that is read by gfx_rle_sprite_to_buffer.
+ */
+static bool sprite_mip_encode_rle(
+    const std::vector<uint8_t>& pixels, const std::vector<uint8_t>& mask, int32_t width, int32_t height,
+    std::vector<uint8_t>& output)
+{
+    output.assign(height * 2, 0);
+    for (int32_t y = 0; y < height; y++)
+    {
+        if (output.size() > UINT16_MAX)
+        {
+            return false;
+        }
+        uint16_t lineOffset = (uint16_t)output.size();
+        std::copy_n((const uint8_t*)&lineOffset, sizeof(lineOffset), output.begin() + y * 2);
+
+        size_t lastRunHeader = SIZE_MAX;
+        int32_t x = 0;
+        while (x < width)
+        {
+            size_t index = y * width + x;
+            if (!mask[index])
+            {
+                x++;
+                continue;
+            }
+
+            int32_t runLength = 0;
+            while (x + runLength < width && runLength < 127 && mask[index + runLength])
+            {
+                runLength++;
+            }
+
+            lastRunHeader = output.size();
+            output.push_back((uint8_t)runLength);
+            output.push_back((uint8_t)x);
+            output.insert(output.end(), pixels.begin() + index, pixels.begin() + index + runLength);
+            x += runLength;
+        }
+
+        if (lastRunHeader == SIZE_MAX)
+        {
+            // Empty line
+            output.push_back(0x80);
+            output.push_back(0);
+        }
+        else
+        {
+            output[lastRunHeader] |= 0x80;
+        }
+    }
+    return true;
+}
+
+static bool sprite_mip_build(const rct_g1_element& source, int32_t level, int32_t phaseY, SpriteMipEntry& entry)
+{
+    // The run headers store the x position in a byte
+    const int32_t step = 1 << level;
+    const int32_t width = (source.width + step - 1) >> level;
+    const int32_t height = source.height > phaseY ? (source.height - phaseY + step - 1) >> level : 0;
+    if (width > 256 || source.offset == nullptr)
+    {
+        return false;
+    }
+
+    std::vector<uint8_t> srcPixels;
+    std::vector<uint8_t> srcMask;
+    if (!sprite_mip_decode(source, srcPixels, srcMask))
+    {
+        return false;
+    }
+
+    // Take every step-th pixel starting from the first column and the given row, the same pixels the zoomed blitters
+    // would have sampled
+    std::vector<uint8_t> pixels(width * height);
+    std::vector<uint8_t> mask(width * height);
+    for (int32_t y = 0; y < height; y++)
+    {
+        for (int32_t x = 0; x < width; x++)
+        {
+            size_t srcIndex = (phaseY + y * step) * source.width + (x * step);
+            pixels[y * width + x] = srcPixels[srcIndex];
+            mask[y * width + x] = srcMask[srcIndex];
+        }
+    }
+
+    if (!sprite_mip_encode_rle(pixels, mask, width, height, entry.Data))
+    {
+        return false;
+    }
+
+    entry.Source = source;
+    entry.Element = {};
+    entry.Element.width = width;
+    entry.Element.height = height;
+    // The caller positions the copy, as where it is drawn depends on the rounding of the position it is drawn at
+    entry.Element.x_offset = 0;
+    entry.Element.y_offset = 0;
+    entry.Element.flags = G1_FLAG_RLE_COMPRESSION;
+    return true;
+}
+
+static bool sprite_mip_is_cacheable(int32_t imageId, const rct_g1_element* source)
+{
+    // Images whose pixels are rewritten in place can not be cached
+    if (imageId == SPR_TEMP || (imageId >= SPR_SCROLLING_TEXT_START && imageId < SPR_SCROLLING_TEXT_DEFAULT))
+    {
+        return false;
+    }
+    if (source->flags & (G1_FLAG_1 | G1_FLAG_PALETTE | G1_FLAG_HAS_ZOOM_SPRITE | G1_FLAG_NO_ZOOM_DRAW))
+    {
+        return false;
+    }
+    return source->width > 0 && source->height > 0;
+}
+
+/**
+ * Gets a copy of an image downscaled by 2^level, made of every 2^level-th pixel of the first column and of row phaseY
+ * onwards. Returns nullptr if the image can not be downscaled, in which case it should be drawn by sampling the full
+ * resolution image.
+ */
+std::shared_ptr<const rct_g1_element> sprite_mip_cache_get(
+    int32_t imageId, int32_t level, int32_t phaseY, const rct_g1_element* source)
+{
+    if (level < 1 || level > SPRITE_MIP_MAX_LEVEL || phaseY < 0 || phaseY >= (1 << level)
+        || !sprite_mip_is_cacheable(imageId, source))
+    {
+        return nullptr;
+    }
+
+    uint32_t key = sprite_mip_get_key(imageId, level, phaseY);
+    {
+        std::lock_guard<std::mutex> lock(_mipMutex);
+        auto found = _mipLookup.find(key);
+        if (found != _mipLookup.end())
+        {
+            auto it = found->second;
+            if (sprite_mip_is_same_element((*it)->Source, *source))
+            {
+                _mipEntries.splice(_mipEntries.begin(), _mipEntries, it);
+                return std::shared_ptr<const rct_g1_element>(*it, &(*it)->Element);
+            }
+            sprite_mip_remove(it);
+        }
+    }
+
+    auto entry = std::make_shared<SpriteMipEntry>();
+    entry->Key = key;
+    if (!sprite_mip_build(*source, level, phaseY, *entry))
+    {
+        return nullptr;
+    }
+    entry->Element.offset = entry->Data.data();
+
+    std::lock_guard<std::mutex> lock(_mipMutex);
+    auto found = _mipLookup.find(key);
+    if (found != _mipLookup.end())
+    {
+        // Built by another thread in the meantime
+        sprite_mip_remove(found->second);
+    }
+
+    size_t entrySize = entry->Data.size();
+    while (!_mipEntries.empty() && _mipBytes + entrySize > SPRITE_MIP_CACHE_MAX_BYTES)
+    {
+        sprite_mip_remove(std::prev(_mipEntries.end()));
+    }
+
+    _mipEntries.push_front(entry);
+    _mipLookup[key] = _mipEntries.begin();
+    _mipBytes += entrySize;
+    return std::shared_ptr<const rct_g1_element>(entry, &entry->Element);
+}
+
+void sprite_mip_cache_invalidate(int32_t imageId)
+{
+    std::lock_guard<std::mutex> lock(_mipMutex);
+    for (int32_t level = 1; level <= SPRITE_MIP_MAX_LEVEL; level++)
+    {
+        for (int32_t phaseY = 0; phaseY < (1 << level); phaseY++)
+        {
+            auto found = _mipLookup.find(sprite_mip_get_key(imageId, level, phaseY));
+            if (found != _mipLookup.end())
+            {
+                sprite_mip_remove(found->second);
+            }
+        }
+    }
+}
+
+void sprite_mip_cache_clear()
+{
+    std::lock_guard<std::mutex> lock(_mipMutex);
+    _mipEntries.clear();
+    _mipLookup.clear();
+    _mipBytes = 0;
+}
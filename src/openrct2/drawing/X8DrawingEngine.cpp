@@ -292,7 +292,7 @@ rct_drawpixelinfo* X8DrawingEngine::GetDrawingPixelInfo()
 
 DRAWING_ENGINE_FLAGS X8DrawingEngine::GetFlags()
 {
-    return DEF_DIRTY_OPTIMISATIONS;
+    return (DRAWING_ENGINE_FLAGS)(DEF_DIRTY_OPTIMISATIONS | DEF_PARALLEL_DRAWING);
 }
 
 void X8DrawingEngine::InvalidateImage([[maybe_unused]] uint32_t image)
@@ -464,6 +464,8 @@ void X8DrawingEngine::DrawDirtyBlocks(uint32_t x, uint32_t y, uint32_t columns,
 #    pragma GCC diagnostic pop
 #endif
 
+thread_local rct_drawpixelinfo* X8DrawingContext::_dpi = nullptr;
+
 X8DrawingContext::X8DrawingContext(X8DrawingEngine* engine)
 {
     _engine = engine;
@@ -123,7 +123,8 @@ namespace OpenRCT2
         {
         private:
             X8DrawingEngine* _engine = nullptr;
-            rct_drawpixelinfo* _dpi = nullptr;
+            // Per thread so that viewport columns can be drawn in parallel
+            static thread_local rct_drawpixelinfo* _dpi;
 
         public:
             explicit X8DrawingContext(X8DrawingEngine* engine);
@@ -13,6 +13,7 @@
 #include "../EditorObjectSelectionSession.h"
 #include "../Game.h"
 #include "../OpenRCT2.h"
+#include "../ReplayManager.h"
 #include "../Version.h"
 #include "../config/Config.h"
 #include "../core/Guard.hpp"
@@ -1291,6 +1292,74 @@ static int32_t cc_save_park(
     return 1;
 }
 
+static int32_t cc_replay_startrecord(InteractiveConsole& console, const utf8** argv, int32_t argc)
+{
+    if (argc < 1)
+    {
+        console.WriteLineError("Expected a file name.");
+        return 1;
+    }
+
+    uint32_t checksumInterval = OpenRCT2::REPLAY_DEFAULT_CHECKSUM_INTERVAL;
+    if (argc >= 2)
+    {
+        checksumInterval = (uint32_t)std::max(0, atoi(argv[1]));
+    }
+
+    auto replayManager = OpenRCT2::GetContext()->GetReplayManager();
+    if (!replayManager->StartRecording(argv[0], checksumInterval))
+    {
+        console.WriteLineError("Unable to start recording.");
+        return 1;
+    }
+    console.WriteFormatLine("Recording to '%s'.", argv[0]);
+    return 0;
+}
+
+static int32_t cc_replay_stoprecord(
+    InteractiveConsole& console, [[maybe_unused]] const utf8** argv, [[maybe_unused]] int32_t argc)
+{
+    auto replayManager = OpenRCT2::GetContext()->GetReplayManager();
+    if (!replayManager->StopRecording())
+    {
+        console.WriteLineError("Unable to save the recording.");
+        return 1;
+    }
+    console.WriteLine("Recording saved.");
+    return 0;
+}
+
+static int32_t cc_replay_startplay(InteractiveConsole& console, const utf8** argv, int32_t argc)
+{
+    if (argc < 1)
+    {
+        console.WriteLineError("Expected a file name.");
+        return 1;
+    }
+
+    auto replayManager = OpenRCT2::GetContext()->GetReplayManager();
+    if (!replayManager->StartPlayback(argv[0]))
+    {
+        console.WriteLineError("Unable to start playback.");
+        return 1;
+    }
+    console.WriteFormatLine("Replaying '%s'.", argv[0]);
+    return 0;
+}
+
+static int32_t cc_replay_stopplay(
+    InteractiveConsole& console, [[maybe_unused]] const utf8** argv, [[maybe_unused]] int32_t argc)
+{
+    auto replayManager = OpenRCT2::GetContext()->GetReplayManager();
+    if (!replayManager->StopPlayback())
+    {
+        console.WriteLineError("No replay is being played.");
+        return 1;
+    }
+    console.WriteLine("Playback stopped.");
+    return 0;
+}
+
 using console_command_func = int32_t (*)(InteractiveConsole& console, const utf8** argv, int32_t argc);
 struct console_command
 {
@@ -1377,6 +1446,10 @@ static constexpr const console_command console_command_table[] = {
     { "show_limits", cc_show_limits, "Shows the map data counts and limits.", "show_limits" },
     { "date", cc_for_date, "Sets the date to a given date.", "Format <year>[ <month>[ <day>]]."},
     { "save_park", cc_save_park, "Save current state of park. If no name specified default path will be used.", "save_park [name]"},
+    { "replay_startrecord", cc_replay_startrecord, "Starts recording the park and all game commands to a replay file.", "replay_startrecord <file> [checksum interval]"},
+    { "replay_stoprecord", cc_replay_stoprecord, "Stops recording and saves the replay file.", "replay_stoprecord"},
+    { "replay_startplay", cc_replay_startplay, "Loads the park from a replay file and replays its game commands.", "replay_startplay <file>"},
+    { "replay_stopplay", cc_replay_stopplay, "Stops the replay that is currently playing.", "replay_stopplay"},
 };
 // clang-format on
 
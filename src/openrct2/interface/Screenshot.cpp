@@ -15,6 +15,7 @@
 #include "../OpenRCT2.h"
 #include "../audio/audio.h"
 #include "../core/Console.hpp"
+#include "../core/File.h"
 #include "../core/Imaging.h"
 #include "../drawing/Drawing.h"
 #include "../localisation/Localisation.h"
@@ -26,12 +27,18 @@
 #include "../world/Surface.h"
 #include "Viewport.h"
 
+#include <algorithm>
 #include <chrono>
 #include <cstdlib>
 #include <memory>
+#include <string>
+#include <vector>
 
 using namespace OpenRCT2;
 
+// Number of rows of a giant screenshot that are rendered at a time
+constexpr int32_t SCREENSHOT_BAND_HEIGHT = 256;
+
 uint8_t gScreenshotCountdown = 0;
 
 static bool WriteDpiToFile(const std::string_view& path, const rct_drawpixelinfo* dpi, const rct_palette& palette)
@@ -57,6 +64,58 @@ static bool WriteDpiToFile(const std::string_view& path, const rct_drawpixelinfo
     }
 }
 
+/**
+ * Renders the viewport in horizontal bands which are passed to the encoder as soon as they have been drawn, so that only
+ * one band has to be held in memory regardless of the size of the map.
+ */
+static bool WriteViewportToFile(const std::string_view& path, rct_viewport* viewport, const rct_palette& palette)
+{
+    const int32_t width = viewport->width;
+    const int32_t height = viewport->height;
+    const int32_t bandHeight = std::min(height, SCREENSHOT_BAND_HEIGHT);
+    std::vector<uint8_t> band(width * bandHeight);
+
+    rct_drawpixelinfo dpi;
+    dpi.bits = band.data();
+    dpi.x = viewport->x;
+    dpi.y = viewport->y;
+    dpi.width = width;
+    dpi.height = 0;
+    dpi.pitch = 0;
+    dpi.zoom_level = 0;
+
+    auto getRow = [&](uint32_t row) -> const uint8_t* {
+        int32_t y = viewport->y + (int32_t)row;
+        if (y >= dpi.y + dpi.height)
+        {
+            dpi.y = y;
+            dpi.height = std::min(bandHeight, viewport->y + height - y);
+
+            // Areas that nothing is drawn to are left transparent rather than showing the previous band
+            std::fill(band.begin(), band.end(), 0);
+            viewport_render(&dpi, viewport, dpi.x, dpi.y, dpi.x + width, dpi.y + dpi.height);
+        }
+        return band.data() + (y - dpi.y) * width;
+    };
+
+    try
+    {
+        Image header;
+        header.Width = width;
+        header.Height = height;
+        header.Depth = 8;
+        header.Stride = width;
+        header.Palette = std::make_unique<rct_palette>(palette);
+        Imaging::WriteToFile(path, header, getRow, IMAGE_FORMAT::PNG);
+        return true;
+    }
+    catch (const std::exception& e)
+    {
+        log_error("Unable to write png: %s", e.what());
+        return false;
+    }
+}
+
 /**
  *
  *  rct2: 0x006E3AEC
@@ -288,17 +347,6 @@ void screenshot_giant()
     // Ensure sprites appear regardless of rotation
     reset_all_sprite_quadrant_placements();
 
-    rct_drawpixelinfo dpi;
-    dpi.x = 0;
-    dpi.y = 0;
-    dpi.width = resolutionWidth;
-    dpi.height = resolutionHeight;
-    dpi.pitch = 0;
-    dpi.zoom_level = 0;
-    dpi.bits = (uint8_t*)malloc(dpi.width * dpi.height);
-
-    viewport_render(&dpi, &viewport, 0, 0, viewport.width, viewport.height);
-
     // Get a free screenshot path
     char path[MAX_PATH];
     if (screenshot_get_next_path(path, MAX_PATH) == -1)
@@ -311,9 +359,11 @@ void screenshot_giant()
     rct_palette renderedPalette;
     screenshot_get_rendered_palette(&renderedPalette);
 
-    WriteDpiToFile(path, &dpi, renderedPalette);
-
-    free(dpi.bits);
+    if (!WriteViewportToFile(path, &viewport, renderedPalette))
+    {
+        context_show_error(STR_SCREENSHOT_FAILED, STR_NONE);
+        return;
+    }
 
     // Show user that screenshot saved successfully
     set_format_arg(0, rct_string_id, STR_STRING);
@@ -422,222 +472,368 @@ int32_t cmdline_for_gfxbench(const char** argv, int32_t argc)
     return 1;
 }
 
-int32_t cmdline_for_screenshot(const char** argv, int32_t argc, ScreenshotOptions* options)
+struct CommandLineScreenshot
+{
+    std::string InputPath;
+    std::string OutputPath;
+    int32_t Width = 0;
+    int32_t Height = 0;
+    bool CustomLocation = false;
+    bool CentreMapX = false;
+    bool CentreMapY = false;
+    int32_t X = 0;
+    int32_t Y = 0;
+    int32_t Zoom = 0;
+    int32_t Rotation = 0;
+};
+
+static bool screenshot_parse_arguments(const char** argv, int32_t argc, CommandLineScreenshot* screenshot)
 {
-    // Don't include options in the count (they have been handled by CommandLine::ParseOptions already)
-    for (int32_t i = 0; i < argc; i++)
-    {
-        if (argv[i][0] == '-')
-        {
-            // Setting argc to i works, because options can only be at the end of the command
-            argc = i;
-            break;
-        }
-    }
-
     bool giantScreenshot = (argc == 5) && _stricmp(argv[2], "giant") == 0;
     if (argc != 4 && argc != 8 && !giantScreenshot)
     {
-        std::printf("Usage: openrct2 screenshot <file> <output_image> <width> <height> [<x> <y> <zoom> <rotation>]\n");
-        std::printf("Usage: openrct2 screenshot <file> <output_image> giant <zoom> <rotation>\n");
-        return -1;
+        return false;
     }
 
-    core_init();
-    bool customLocation = false;
-    bool centreMapX = false;
-    bool centreMapY = false;
-    int32_t resolutionWidth, resolutionHeight, customX = 0, customY = 0, customZoom, customRotation = 0;
-
-    const char* inputPath = argv[0];
-    const char* outputPath = argv[1];
+    screenshot->InputPath = argv[0];
+    screenshot->OutputPath = argv[1];
     if (giantScreenshot)
     {
-        resolutionWidth = 0;
-        resolutionHeight = 0;
-        customLocation = true;
-        centreMapX = true;
-        centreMapY = true;
-        customZoom = std::atoi(argv[3]);
-        customRotation = std::atoi(argv[4]) & 3;
+        screenshot->CustomLocation = true;
+        screenshot->CentreMapX = true;
+        screenshot->CentreMapY = true;
+        screenshot->Zoom = std::atoi(argv[3]);
+        screenshot->Rotation = std::atoi(argv[4]) & 3;
     }
     else
     {
-        resolutionWidth = std::atoi(argv[2]);
-        resolutionHeight = std::atoi(argv[3]);
+        screenshot->Width = std::atoi(argv[2]);
+        screenshot->Height = std::atoi(argv[3]);
         if (argc == 8)
         {
-            customLocation = true;
+            screenshot->CustomLocation = true;
             if (argv[4][0] == 'c')
-                centreMapX = true;
+                screenshot->CentreMapX = true;
             else
-                customX = std::atoi(argv[4]);
+                screenshot->X = std::atoi(argv[4]);
 
             if (argv[5][0] == 'c')
-                centreMapY = true;
+                screenshot->CentreMapY = true;
             else
-                customY = std::atoi(argv[5]);
+                screenshot->Y = std::atoi(argv[5]);
 
-            customZoom = std::atoi(argv[6]);
-            customRotation = std::atoi(argv[7]) & 3;
-        }
-        else
-        {
-            customZoom = 0;
+            screenshot->Zoom = std::atoi(argv[6]);
+            screenshot->Rotation = std::atoi(argv[7]) & 3;
         }
     }
+    return true;
+}
 
-    gOpenRCT2Headless = true;
-    auto context = CreateContext();
-    if (context->Initialise())
+static void screenshot_print_usage()
+{
+    std::printf("Usage: openrct2 screenshot <file> <output_image> <width> <height> [<x> <y> <zoom> <rotation>]\n");
+    std::printf("Usage: openrct2 screenshot <file> <output_image> giant <zoom> <rotation>\n");
+    std::printf("Usage: openrct2 screenshot batch <manifest>\n");
+}
+
+static bool screenshot_validate_options(const ScreenshotOptions* options)
+{
+    if (options->weather < 0 || options->weather > 6)
     {
-        drawing_engine_init();
+        std::printf("Weather can only be set to an integer value from 1 till 6.");
+        return false;
+    }
+    return true;
+}
 
-        try
-        {
-            context->LoadParkFromFile(inputPath);
-        }
-        catch (const std::exception& e)
+/**
+ * Loads the park into the given context and renders it. The context, and with it the sprite data and any objects that
+ * the next park has in common with this one, can be reused for further screenshots.
+ */
+static bool screenshot_render_park(IContext* context, const CommandLineScreenshot& screenshot, const ScreenshotOptions* options)
+{
+    try
+    {
+        if (!context->LoadParkFromFile(screenshot.InputPath))
         {
-            std::printf("%s\n", e.what());
-            drawing_engine_dispose();
-            return -1;
+            std::printf("Unable to load park '%s'.\n", screenshot.InputPath.c_str());
+            return false;
         }
+    }
+    catch (const std::exception& e)
+    {
+        std::printf("%s\n", e.what());
+        return false;
+    }
 
-        gIntroState = INTRO_STATE_NONE;
-        gScreenFlags = SCREEN_FLAGS_PLAYING;
+    gIntroState = INTRO_STATE_NONE;
+    gScreenFlags = SCREEN_FLAGS_PLAYING;
 
-        int32_t mapSize = gMapSize;
-        if (resolutionWidth == 0 || resolutionHeight == 0)
-        {
-            resolutionWidth = (mapSize * 32 * 2) >> customZoom;
-            resolutionHeight = (mapSize * 32 * 1) >> customZoom;
+    int32_t mapSize = gMapSize;
+    int32_t resolutionWidth = screenshot.Width;
+    int32_t resolutionHeight = screenshot.Height;
+    int32_t customX = screenshot.X;
+    int32_t customY = screenshot.Y;
+    int32_t customZoom = screenshot.Zoom;
+    int32_t customRotation = screenshot.Rotation;
+    if (resolutionWidth == 0 || resolutionHeight == 0)
+    {
+        resolutionWidth = (mapSize * 32 * 2) >> customZoom;
+        resolutionHeight = (mapSize * 32 * 1) >> customZoom;
 
-            resolutionWidth += 8;
-            resolutionHeight += 128;
-        }
+        resolutionWidth += 8;
+        resolutionHeight += 128;
+    }
 
-        rct_viewport viewport;
-        viewport.x = 0;
-        viewport.y = 0;
-        viewport.width = resolutionWidth;
-        viewport.height = resolutionHeight;
-        viewport.view_width = viewport.width;
-        viewport.view_height = viewport.height;
-        viewport.var_11 = 0;
-        viewport.flags = 0;
-
-        if (customLocation)
-        {
-            if (centreMapX)
-                customX = (mapSize / 2) * 32 + 16;
-            if (centreMapY)
-                customY = (mapSize / 2) * 32 + 16;
-
-            int32_t x = 0, y = 0;
-            int32_t z = tile_element_height(customX, customY) & 0xFFFF;
-            switch (customRotation)
-            {
-                case 0:
-                    x = customY - customX;
-                    y = ((customX + customY) / 2) - z;
-                    break;
-                case 1:
-                    x = -customY - customX;
-                    y = ((-customX + customY) / 2) - z;
-                    break;
-                case 2:
-                    x = -customY + customX;
-                    y = ((-customX - customY) / 2) - z;
-                    break;
-                case 3:
-                    x = customY + customX;
-                    y = ((customX - customY) / 2) - z;
-                    break;
-            }
+    rct_viewport viewport;
+    viewport.x = 0;
+    viewport.y = 0;
+    viewport.width = resolutionWidth;
+    viewport.height = resolutionHeight;
+    viewport.view_width = viewport.width;
+    viewport.view_height = viewport.height;
+    viewport.var_11 = 0;
+    viewport.flags = 0;
 
-            viewport.view_x = x - ((viewport.view_width << customZoom) / 2);
-            viewport.view_y = y - ((viewport.view_height << customZoom) / 2);
-            viewport.zoom = customZoom;
-            gCurrentRotation = customRotation;
-        }
-        else
+    if (screenshot.CustomLocation)
+    {
+        if (screenshot.CentreMapX)
+            customX = (mapSize / 2) * 32 + 16;
+        if (screenshot.CentreMapY)
+            customY = (mapSize / 2) * 32 + 16;
+
+        int32_t x = 0, y = 0;
+        int32_t z = tile_element_height(customX, customY) & 0xFFFF;
+        switch (customRotation)
         {
-            viewport.view_x = gSavedViewX - (viewport.view_width / 2);
-            viewport.view_y = gSavedViewY - (viewport.view_height / 2);
-            viewport.zoom = gSavedViewZoom;
-            gCurrentRotation = gSavedViewRotation;
+            case 0:
+                x = customY - customX;
+                y = ((customX + customY) / 2) - z;
+                break;
+            case 1:
+                x = -customY - customX;
+                y = ((-customX + customY) / 2) - z;
+                break;
+            case 2:
+                x = -customY + customX;
+                y = ((-customX - customY) / 2) - z;
+                break;
+            case 3:
+                x = customY + customX;
+                y = ((customX - customY) / 2) - z;
+                break;
         }
 
-        if (options->weather != 0)
-        {
-            if (options->weather < 1 || options->weather > 6)
-            {
-                std::printf("Weather can only be set to an integer value from 1 till 6.");
-                drawing_engine_dispose();
-                return -1;
-            }
+        viewport.view_x = x - ((viewport.view_width << customZoom) / 2);
+        viewport.view_y = y - ((viewport.view_height << customZoom) / 2);
+        viewport.zoom = customZoom;
+        gCurrentRotation = customRotation;
+    }
+    else
+    {
+        viewport.view_x = gSavedViewX - (viewport.view_width / 2);
+        viewport.view_y = gSavedViewY - (viewport.view_height / 2);
+        viewport.zoom = gSavedViewZoom;
+        gCurrentRotation = gSavedViewRotation;
+    }
 
-            uint8_t customWeather = options->weather - 1;
-            climate_force_weather(customWeather);
-        }
+    if (options->weather != 0)
+    {
+        uint8_t customWeather = options->weather - 1;
+        climate_force_weather(customWeather);
+    }
 
-        // Ensure sprites appear regardless of rotation
-        reset_all_sprite_quadrant_placements();
+    // Ensure sprites appear regardless of rotation
+    reset_all_sprite_quadrant_placements();
 
-        rct_drawpixelinfo dpi;
-        dpi.x = 0;
-        dpi.y = 0;
-        dpi.width = resolutionWidth;
-        dpi.height = resolutionHeight;
-        dpi.pitch = 0;
-        dpi.zoom_level = 0;
-        dpi.bits = (uint8_t*)malloc(dpi.width * dpi.height);
+    if (options->hide_guests)
+    {
+        viewport.flags |= VIEWPORT_FLAG_INVISIBLE_PEEPS;
+    }
 
-        if (options->hide_guests)
-        {
-            viewport.flags |= VIEWPORT_FLAG_INVISIBLE_PEEPS;
-        }
+    if (options->hide_sprites)
+    {
+        viewport.flags |= VIEWPORT_FLAG_INVISIBLE_SPRITES;
+    }
+
+    if (options->mowed_grass)
+    {
+        game_do_command(0, GAME_COMMAND_FLAG_APPLY, CHEAT_SETGRASSLENGTH, GRASS_LENGTH_MOWED, GAME_COMMAND_CHEAT, 0, 0);
+    }
+
+    if (options->clear_grass || options->tidy_up_park)
+    {
+        game_do_command(0, GAME_COMMAND_FLAG_APPLY, CHEAT_SETGRASSLENGTH, GRASS_LENGTH_CLEAR_0, GAME_COMMAND_CHEAT, 0, 0);
+    }
+
+    if (options->water_plants || options->tidy_up_park)
+    {
+        game_do_command(0, GAME_COMMAND_FLAG_APPLY, CHEAT_WATERPLANTS, 0, GAME_COMMAND_CHEAT, 0, 0);
+    }
+
+    if (options->fix_vandalism || options->tidy_up_park)
+    {
+        game_do_command(0, GAME_COMMAND_FLAG_APPLY, CHEAT_FIXVANDALISM, 0, GAME_COMMAND_CHEAT, 0, 0);
+    }
+
+    if (options->remove_litter || options->tidy_up_park)
+    {
+        game_do_command(0, GAME_COMMAND_FLAG_APPLY, CHEAT_REMOVELITTER, 0, GAME_COMMAND_CHEAT, 0, 0);
+    }
+
+    rct_palette renderedPalette;
+    screenshot_get_rendered_palette(&renderedPalette);
+
+    return WriteViewportToFile(screenshot.OutputPath, &viewport, renderedPalette);
+}
 
-        if (options->hide_sprites)
+int32_t cmdline_for_screenshot(const char** argv, int32_t argc, ScreenshotOptions* options)
+{
+    // Don't include options in the count (they have been handled by CommandLine::ParseOptions already)
+    for (int32_t i = 0; i < argc; i++)
+    {
+        if (argv[i][0] == '-')
         {
-            viewport.flags |= VIEWPORT_FLAG_INVISIBLE_SPRITES;
+            // Setting argc to i works, because options can only be at the end of the command
+            argc = i;
+            break;
         }
+    }
+
+    CommandLineScreenshot screenshot;
+    if (!screenshot_parse_arguments(argv, argc, &screenshot))
+    {
+        screenshot_print_usage();
+        return -1;
+    }
+    if (!screenshot_validate_options(options))
+    {
+        return -1;
+    }
 
-        if (options->mowed_grass)
+    core_init();
+    gOpenRCT2Headless = true;
+    auto context = CreateContext();
+    if (context->Initialise())
+    {
+        drawing_engine_init();
+        bool result = screenshot_render_park(context.get(), screenshot, options);
+        drawing_engine_dispose();
+        if (!result)
         {
-            game_do_command(0, GAME_COMMAND_FLAG_APPLY, CHEAT_SETGRASSLENGTH, GRASS_LENGTH_MOWED, GAME_COMMAND_CHEAT, 0, 0);
+            return -1;
         }
+    }
+    return 1;
+}
 
-        if (options->clear_grass || options->tidy_up_park)
+/**
+ * Splits a manifest line into arguments separated by white space. Arguments containing spaces can be enclosed in double
+ * quotes.
+ */
+static std::vector<std::string> screenshot_split_manifest_line(const std::string& line)
+{
+    std::vector<std::string> arguments;
+    std::string argument;
+    bool inArgument = false;
+    bool inQuotes = false;
+    for (char c : line)
+    {
+        if (c == '"')
         {
-            game_do_command(0, GAME_COMMAND_FLAG_APPLY, CHEAT_SETGRASSLENGTH, GRASS_LENGTH_CLEAR_0, GAME_COMMAND_CHEAT, 0, 0);
+            inQuotes = !inQuotes;
+            inArgument = true;
         }
-
-        if (options->water_plants || options->tidy_up_park)
+        else if (!inQuotes && (c == ' ' || c == '\t' || c == '\r'))
         {
-            game_do_command(0, GAME_COMMAND_FLAG_APPLY, CHEAT_WATERPLANTS, 0, GAME_COMMAND_CHEAT, 0, 0);
+            if (inArgument)
+            {
+                arguments.push_back(argument);
+                argument.clear();
+                inArgument = false;
+            }
         }
-
-        if (options->fix_vandalism || options->tidy_up_park)
+        else
         {
-            game_do_command(0, GAME_COMMAND_FLAG_APPLY, CHEAT_FIXVANDALISM, 0, GAME_COMMAND_CHEAT, 0, 0);
+            argument.push_back(c);
+            inArgument = true;
         }
+    }
+    if (inArgument)
+    {
+        arguments.push_back(argument);
+    }
+    return arguments;
+}
+
+int32_t cmdline_for_screenshot_batch(const char* manifestPath, ScreenshotOptions* options)
+{
+    if (!screenshot_validate_options(options))
+    {
+        return -1;
+    }
 
-        if (options->remove_litter || options->tidy_up_park)
+    // Parse the whole manifest up front so that mistakes are reported before any park is rendered
+    std::vector<CommandLineScreenshot> screenshots;
+    try
+    {
+        auto lines = File::ReadAllLines(manifestPath);
+        for (size_t i = 0; i < lines.size(); i++)
         {
-            game_do_command(0, GAME_COMMAND_FLAG_APPLY, CHEAT_REMOVELITTER, 0, GAME_COMMAND_CHEAT, 0, 0);
-        }
+            auto arguments = screenshot_split_manifest_line(lines[i]);
+            if (arguments.empty() || arguments[0][0] == '#')
+            {
+                continue;
+            }
 
-        viewport_render(&dpi, &viewport, 0, 0, viewport.width, viewport.height);
+            std::vector<const char*> argv;
+            for (const auto& argument : arguments)
+            {
+                argv.push_back(argument.c_str());
+            }
 
-        rct_palette renderedPalette;
-        screenshot_get_rendered_palette(&renderedPalette);
+            CommandLineScreenshot screenshot;
+            if (!screenshot_parse_arguments(argv.data(), (int32_t)argv.size(), &screenshot))
+            {
+                std::printf("Invalid screenshot on line %d of the manifest.\n", (int32_t)(i + 1));
+                screenshot_print_usage();
+                return -1;
+            }
+            screenshots.push_back(screenshot);
+        }
+    }
+    catch (const std::exception& e)
+    {
+        std::printf("Unable to read manifest: %s\n", e.what());
+        return -1;
+    }
 
-        WriteDpiToFile(outputPath, &dpi, renderedPalette);
+    core_init();
+    gOpenRCT2Headless = true;
+    auto context = CreateContext();
+    if (!context->Initialise())
+    {
+        return -1;
+    }
 
-        free(dpi.bits);
-        drawing_engine_dispose();
+    // Parks share the global game state so they are rendered one after the other, each of them still uses all threads
+    // for painting when multithreading is enabled
+    drawing_engine_init();
+    size_t numFailed = 0;
+    auto startTime = std::chrono::high_resolution_clock::now();
+    for (const auto& screenshot : screenshots)
+    {
+        if (!screenshot_render_park(context.get(), screenshot, options))
+        {
+            std::printf("Unable to create screenshot of '%s'.\n", screenshot.InputPath.c_str());
+            numFailed++;
+        }
     }
-    return 1;
+    std::chrono::duration<double> duration = std::chrono::high_resolution_clock::now() - startTime;
+    drawing_engine_dispose();
+
+    Console::WriteLine(
+        "Rendered %d of %d screenshots in %.2f seconds.", (int32_t)(screenshots.size() - numFailed),
+        (int32_t)screenshots.size(), duration.count());
+    return numFailed == 0 ? 1 : -1;
 }
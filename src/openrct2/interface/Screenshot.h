@@ -35,4 +35,5 @@ int32_t screenshot_dump_png_32bpp(int32_t width, int32_t height, const void* pix
 
 void screenshot_giant();
 int32_t cmdline_for_screenshot(const char** argv, int32_t argc, ScreenshotOptions* options);
+int32_t cmdline_for_screenshot_batch(const char* manifestPath, ScreenshotOptions* options);
 int32_t cmdline_for_gfxbench(const char** argv, int32_t argc);
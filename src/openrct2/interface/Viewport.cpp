@@ -14,6 +14,7 @@
 #include "../Input.h"
 #include "../OpenRCT2.h"
 #include "../config/Config.h"
+#include "../core/JobPool.hpp"
 #include "../drawing/Drawing.h"
 #include "../paint/Paint.h"
 #include "../peep/Staff.h"
@@ -30,6 +31,8 @@
 
 #include <algorithm>
 #include <cstring>
+#include <memory>
+#include <vector>
 
 using namespace OpenRCT2;
 
@@ -42,6 +45,7 @@ rct_viewport g_viewport_list[MAX_VIEWPORT_COUNT];
 rct_viewport* g_music_tracking_viewport;
 
 static TileElement* _interaction_element = nullptr;
+static std::unique_ptr<JobPool> _paintJobPool;
 
 int16_t gSavedViewX;
 int16_t gSavedViewY;
@@ -61,7 +65,9 @@ static int16_t _interactionMapX;
 static int16_t _interactionMapY;
 static uint16_t _unk9AC154;
 
-static void viewport_paint_column(rct_drawpixelinfo* dpi, uint32_t viewFlags);
+static bool viewport_can_paint_columns_in_parallel(size_t numColumns);
+static void viewport_paint_column(paint_session* session, uint32_t viewFlags);
+static void viewport_paint_column_money(paint_session* session);
 static void viewport_paint_weather_gloom(rct_drawpixelinfo* dpi);
 
 /**
@@ -878,7 +884,8 @@ void viewport_paint(rct_viewport* viewport, rct_drawpixelinfo* dpi, int16_t left
     // this as well as the [x += 32] in the loop causes signed integer overflow -> undefined behaviour.
     int16_t rightBorder = dpi1.x + dpi1.width;
 
-    // Splits the area into 32 pixel columns and renders them
+    // Splits the area into 32 pixel columns
+    std::vector<rct_drawpixelinfo> columns;
     for (x = floor2(dpi1.x, 32); x < rightBorder; x += 32)
     {
         rct_drawpixelinfo dpi2 = dpi1;
@@ -900,14 +907,82 @@ void viewport_paint(rct_viewport* viewport, rct_drawpixelinfo* dpi, int16_t left
         }
         dpi2.width = paintRight - dpi2.x;
 
-        viewport_paint_column(&dpi2, viewFlags);
+        columns.push_back(dpi2);
+    }
+
+    gCurrentViewportFlags = viewFlags;
+
+    if (viewport_can_paint_columns_in_parallel(columns.size()))
+    {
+        // Each column draws into its own part of the screen, so they can be painted at the same time. The money
+        // effects draw text which uses global state, so they are drawn afterwards on this thread.
+        if (_paintJobPool == nullptr)
+        {
+            _paintJobPool = std::make_unique<JobPool>();
+        }
+
+        // Sessions are only kept until after the join for columns with money effects, to keep the number of sessions
+        // in use close to the number of threads.
+        std::vector<paint_session*> moneySessions(columns.size(), nullptr);
+        scrolling_text_pin_begin();
+        for (size_t i = 0; i < columns.size(); i++)
+        {
+            _paintJobPool->AddTask([&columns, &moneySessions, i, viewFlags]() -> void {
+                paint_session* session = paint_session_alloc(&columns[i]);
+                viewport_paint_column(session, viewFlags);
+                if (session->PSStringHead != nullptr)
+                {
+                    moneySessions[i] = session;
+                }
+                else
+                {
+                    paint_session_free(session);
+                }
+            });
+        }
+        _paintJobPool->Join();
+        scrolling_text_pin_end();
+
+        for (auto session : moneySessions)
+        {
+            if (session != nullptr)
+            {
+                viewport_paint_column_money(session);
+                paint_session_free(session);
+            }
+        }
+    }
+    else
+    {
+        for (auto& column : columns)
+        {
+            paint_session* session = paint_session_alloc(&column);
+            viewport_paint_column(session, viewFlags);
+            viewport_paint_column_money(session);
+            paint_session_free(session);
+        }
     }
 }
 
-static void viewport_paint_column(rct_drawpixelinfo* dpi, uint32_t viewFlags)
+static bool viewport_can_paint_columns_in_parallel(size_t numColumns)
 {
-    gCurrentViewportFlags = viewFlags;
+    if (!gConfigGeneral.multithreading || numColumns < 2 || !drawing_engine_supports_parallel_drawing())
+    {
+        return false;
+    }
+#ifdef __ENABLE_LIGHTFX__
+    // Painting adds lights to a global list
+    if (gConfigGeneral.enable_light_fx)
+    {
+        return false;
+    }
+#endif
+    return true;
+}
 
+static void viewport_paint_column(paint_session* session, uint32_t viewFlags)
+{
+    rct_drawpixelinfo* dpi = session->DPI;
     if (viewFlags
         & (VIEWPORT_FLAG_HIDE_VERTICAL | VIEWPORT_FLAG_HIDE_BASE | VIEWPORT_FLAG_UNDERGROUND_INSIDE | VIEWPORT_FLAG_CLIP_VIEW))
     {
@@ -919,21 +994,22 @@ static void viewport_paint_column(rct_drawpixelinfo* dpi, uint32_t viewFlags)
         gfx_clear(dpi, colour);
     }
 
-    paint_session* session = paint_session_alloc(dpi);
     paint_session_generate(session);
     paint_session_arrange(session);
     paint_draw_structs(session, viewFlags);
-    paint_session_free(session);
 
     if (gConfigGeneral.render_weather_gloom && !gTrackDesignSaveMode && !(viewFlags & VIEWPORT_FLAG_INVISIBLE_SPRITES)
         && !(viewFlags & VIEWPORT_FLAG_HIGHLIGHT_PATH_ISSUES))
     {
         viewport_paint_weather_gloom(dpi);
     }
+}
 
+static void viewport_paint_column_money(paint_session* session)
+{
     if (session->PSStringHead != nullptr)
     {
-        paint_draw_money_structs(dpi, session->PSStringHead);
+        paint_draw_money_structs(session->DPI, session->PSStringHead);
     }
 }
 
@@ -28,7 +28,7 @@
 // This string specifies which version of network stream current build uses.
 // It is used for making sure only compatible builds get connected, even within
 // single OpenRCT2 version.
-#define NETWORK_STREAM_VERSION "8"
+#define NETWORK_STREAM_VERSION "9"
 #define NETWORK_STREAM_ID OPENRCT2_VERSION "-" NETWORK_STREAM_VERSION
 
 static rct_peep* _pickup_peep = nullptr;
@@ -692,6 +692,8 @@ bool Network::CheckSRAND(uint32_t tick, uint32_t srand0)
     if (tick == server_srand0_tick)
     {
         server_srand0_tick = 0;
+        CheckStateHashes(tick);
+
         // Check that the server and client sprite hashes match
         const char* client_sprite_hash = sprite_checksum();
         const bool sprites_mismatch = server_sprite_hash[0] != '\0'
@@ -709,12 +711,35 @@ bool Network::CheckSRAND(uint32_t tick, uint32_t srand0)
     return true;
 }
 
+void Network::CheckStateHashes(uint32_t tick)
+{
+    // The state hashes are only diagnostic, they tell us where the first divergence happened
+    // but the desync itself is still decided by the srand0 and sprite checksums.
+    if (!_stateDivergence.empty())
+        return;
+
+    for (const auto& serverHash : server_state_hashes)
+    {
+        uint32_t clientHash;
+        if (NetworkStateHashes::Compute(serverHash.Component, serverHash.Slice, &clientHash) && clientHash != serverHash.Hash)
+        {
+            _stateDivergence = NetworkStateHashes::GetSliceDescription(serverHash.Component, serverHash.Slice);
+            log_warning("Game state diverged from server at tick %u in %s", tick, _stateDivergence.c_str());
+            break;
+        }
+    }
+}
+
 void Network::CheckDesynchronizaton()
 {
     // Check synchronisation
     if (GetMode() == NETWORK_MODE_CLIENT && !_desynchronised && !CheckSRAND(gCurrentTicks, gScenarioSrand0))
     {
         _desynchronised = true;
+        if (!_stateDivergence.empty())
+        {
+            log_warning("Desync detected, first diverging state: %s", _stateDivergence.c_str());
+        }
 
         char str_desync[256];
         format_string(str_desync, 256, STR_MULTIPLAYER_DESYNC, nullptr);
@@ -1360,6 +1385,10 @@ void Network::Server_Send_TICK()
         checksum_counter = 0;
         flags |= NETWORK_TICK_FLAG_CHECKSUMS;
     }
+    if (gConfigNetwork.send_state_hashes)
+    {
+        flags |= NETWORK_TICK_FLAG_STATE_HASHES;
+    }
     // Send flags always, so we can understand packet structure on the other end,
     // and allow for some expansion.
     *packet << flags;
@@ -1367,6 +1396,15 @@ void Network::Server_Send_TICK()
     {
         packet->WriteString(sprite_checksum());
     }
+    if (flags & NETWORK_TICK_FLAG_STATE_HASHES)
+    {
+        auto stateHashes = NetworkStateHashes::Create(gCurrentTicks);
+        *packet << (uint8_t)stateHashes.size();
+        for (const auto& stateHash : stateHashes)
+        {
+            *packet << stateHash.Component << stateHash.Slice << stateHash.Hash;
+        }
+    }
     SendPacketToClients(*packet);
 }
 
@@ -2207,6 +2245,7 @@ void Network::Client_Handle_MAP([[maybe_unused]] NetworkConnection& connection,
             server_srand0_tick = 0;
             // window_network_status_open("Loaded new map from network");
             _desynchronised = false;
+            _stateDivergence.clear();
             gFirstTimeSaving = true;
 
             // Notify user he is now online and which shortcut key enables chat
@@ -2564,6 +2603,18 @@ void Network::Client_Handle_TICK([[maybe_unused]] NetworkConnection& connection,
                 std::memcpy(server_sprite_hash.data(), text, textLen);
             }
         }
+        server_state_hashes.clear();
+        if (flags & NETWORK_TICK_FLAG_STATE_HASHES)
+        {
+            uint8_t count = 0;
+            packet >> count;
+            for (uint8_t i = 0; i < count; i++)
+            {
+                NetworkStateHash stateHash;
+                packet >> stateHash.Component >> stateHash.Slice >> stateHash.Hash;
+                server_state_hashes.push_back(stateHash);
+            }
+        }
     }
     game_commands_processed_this_tick = 0;
 }
@@ -0,0 +1,314 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2018 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "NetworkStateHash.h"
+
+#include "../core/String.hpp"
+#include "../management/Finance.h"
+#include "../peep/Peep.h"
+#include "../ride/Ride.h"
+#include "../world/Map.h"
+#include "../world/Park.h"
+#include "../world/Sprite.h"
+
+#include <algorithm>
+#include <cstring>
+
+// Size of the square map regions the tile elements are hashed in, in tiles
+constexpr int32_t TILE_REGION_SIZE = 32;
+constexpr int32_t RIDES_PER_SLICE = 32;
+constexpr int32_t SPRITES_PER_SLICE = 625;
+
+// How many slices of each component are sent with each tick
+constexpr int32_t TILE_REGIONS_PER_TICK = 4;
+
+/**
+ * A simple 32-bit multiply / rotate hash (based on the MurmurHash3 body). It is much cheaper than
+ * SHA1 and only needs to detect differences, not withstand attacks.
+ */
+class StateHasher
+{
+private:
+    uint32_t _hash = 0x9E3779B9;
+
+public:
+    void Update(const void* data, size_t length)
+    {
+        auto src = static_cast<const uint8_t*>(data);
+        while (length >= 4)
+        {
+            uint32_t word;
+            std::memcpy(&word, src, sizeof(word));
+            Mix(word);
+            src += 4;
+            length -= 4;
+        }
+        uint32_t tail = 0;
+        for (size_t i = 0; i < length; i++)
+        {
+            tail |= src[i] << (i * 8);
+        }
+        Mix(tail);
+    }
+
+    template<typename T> void Update(const T& value)
+    {
+        Update(&value, sizeof(T));
+    }
+
+    uint32_t Finish() const
+    {
+        uint32_t h = _hash;
+        h ^= h >> 16;
+        h *= 0x85EBCA6B;
+        h ^= h >> 13;
+        h *= 0xC2B2AE35;
+        h ^= h >> 16;
+        return h;
+    }
+
+private:
+    void Mix(uint32_t k)
+    {
+        k *= 0xCC9E2D51;
+        k = (k << 15) | (k >> 17);
+        k *= 0x1B873593;
+        _hash ^= k;
+        _hash = (_hash << 13) | (_hash >> 19);
+        _hash = _hash * 5 + 0xE6546B64;
+    }
+};
+
+static int32_t GetTileRegionsPerRow()
+{
+    return (gMapSize + TILE_REGION_SIZE - 1) / TILE_REGION_SIZE;
+}
+
+static int32_t GetSliceCount(uint8_t component)
+{
+    switch (component)
+    {
+        case NETWORK_STATE_COMPONENT_TILE_ELEMENTS:
+            return GetTileRegionsPerRow() * GetTileRegionsPerRow();
+        case NETWORK_STATE_COMPONENT_RIDES:
+            return (MAX_RIDES + RIDES_PER_SLICE - 1) / RIDES_PER_SLICE;
+        case NETWORK_STATE_COMPONENT_PEEPS:
+        case NETWORK_STATE_COMPONENT_VEHICLES:
+            return (MAX_SPRITES + SPRITES_PER_SLICE - 1) / SPRITES_PER_SLICE;
+        case NETWORK_STATE_COMPONENT_FINANCES:
+            return 1;
+        default:
+            return 0;
+    }
+}
+
+/**
+ * Gets a copy of the tile element without the bits that can differ between clients. An element is only the last for its
+ * tile on a client that has no ghost after it, and track is only highlighted for the player constructing the ride.
+ */
+static TileElement GetCanonicalTileElement(const TileElement* tileElement)
+{
+    TileElement canonical = *tileElement;
+    canonical.flags &= ~(TILE_ELEMENT_FLAG_LAST_TILE | TILE_ELEMENT_FLAG_GHOST);
+    if (canonical.GetType() == TILE_ELEMENT_TYPE_TRACK)
+    {
+        canonical.type &= ~TILE_ELEMENT_TYPE_FLAG_HIGHLIGHT;
+    }
+    return canonical;
+}
+
+static uint32_t HashTileRegion(int32_t region)
+{
+    int32_t regionsPerRow = GetTileRegionsPerRow();
+    int32_t left = (region % regionsPerRow) * TILE_REGION_SIZE;
+    int32_t top = (region / regionsPerRow) * TILE_REGION_SIZE;
+    int32_t right = std::min<int32_t>(left + TILE_REGION_SIZE, gMapSize);
+    int32_t bottom = std::min<int32_t>(top + TILE_REGION_SIZE, gMapSize);
+
+    StateHasher hasher;
+    for (int32_t y = top; y < bottom; y++)
+    {
+        for (int32_t x = left; x < right; x++)
+        {
+            TileElement* tileElement = map_get_first_element_at(x, y);
+            if (tileElement == nullptr)
+                continue;
+
+            uint32_t numElements = 0;
+            do
+            {
+                // Ghosts are local previews and never part of the shared game state
+                if (!tileElement->IsGhost())
+                {
+                    hasher.Update(GetCanonicalTileElement(tileElement));
+                    numElements++;
+                }
+            } while (!(tileElement++)->IsLastForTile());
+
+            // Hash where the tile ends, as the last for tile flag is not hashed
+            hasher.Update(numElements);
+        }
+    }
+    return hasher.Finish();
+}
+
+static uint32_t HashRides(int32_t slice)
+{
+    StateHasher hasher;
+    int32_t end = std::min((slice + 1) * RIDES_PER_SLICE, MAX_RIDES);
+    for (int32_t i = slice * RIDES_PER_SLICE; i < end; i++)
+    {
+        // Only hash fields that are part of the simulation, Ride also has padding and UI state
+        auto ride = get_ride(i);
+        hasher.Update(ride->type);
+        if (ride->type == RIDE_TYPE_NULL)
+            continue;
+
+        hasher.Update(ride->subtype);
+        hasher.Update(ride->mode);
+        hasher.Update(ride->status);
+        hasher.Update(ride->lifecycle_flags);
+        hasher.Update(ride->num_vehicles);
+        hasher.Update(ride->num_cars_per_train);
+        hasher.Update(ride->excitement);
+        hasher.Update(ride->intensity);
+        hasher.Update(ride->nausea);
+        hasher.Update(ride->value);
+        hasher.Update(ride->price);
+        hasher.Update(ride->num_riders);
+        hasher.Update(ride->total_customers);
+        hasher.Update(ride->total_profit);
+        hasher.Update(ride->income_per_hour);
+        hasher.Update(ride->profit);
+        hasher.Update(ride->popularity);
+        hasher.Update(ride->reliability);
+        hasher.Update(ride->breakdown_reason);
+    }
+    return hasher.Finish();
+}
+
+static uint32_t HashSprites(int32_t slice, uint8_t spriteIdentifier)
+{
+    StateHasher hasher;
+    size_t end = std::min<size_t>((slice + 1) * SPRITES_PER_SLICE, MAX_SPRITES);
+    for (size_t i = slice * SPRITES_PER_SLICE; i < end; i++)
+    {
+        auto sprite = get_sprite(i);
+        if (sprite->generic.sprite_identifier != spriteIdentifier)
+            continue;
+
+        // Same exclusions as sprite_checksum, the screen bounds and window flags are not game state
+        auto copy = *sprite;
+        copy.generic.sprite_left = copy.generic.sprite_right = copy.generic.sprite_top = copy.generic.sprite_bottom = 0;
+        if (spriteIdentifier == SPRITE_IDENTIFIER_PEEP)
+        {
+            copy.peep.window_invalidate_flags = 0;
+        }
+        hasher.Update(copy);
+    }
+    return hasher.Finish();
+}
+
+static uint32_t HashFinances()
+{
+    StateHasher hasher;
+    hasher.Update(gCash);
+    hasher.Update(gBankLoan);
+    hasher.Update(gCurrentExpenditure);
+    hasher.Update(gCurrentProfit);
+    hasher.Update(gExpenditureTable);
+    hasher.Update(gParkValue);
+    hasher.Update(gCompanyValue);
+    hasher.Update(gParkRating);
+    hasher.Update(gNumGuestsInPark);
+    hasher.Update(gTotalAdmissions);
+    hasher.Update(gTotalIncomeFromAdmissions);
+    return hasher.Finish();
+}
+
+namespace NetworkStateHashes
+{
+    std::vector<NetworkStateHash> Create(uint32_t tick)
+    {
+        std::vector<NetworkStateHash> result;
+        for (uint8_t component = 0; component < NETWORK_STATE_COMPONENT_COUNT; component++)
+        {
+            int32_t sliceCount = GetSliceCount(component);
+            int32_t slicesPerTick = component == NETWORK_STATE_COMPONENT_TILE_ELEMENTS ? TILE_REGIONS_PER_TICK : 1;
+            slicesPerTick = std::min(slicesPerTick, sliceCount);
+            for (int32_t i = 0; i < slicesPerTick; i++)
+            {
+                NetworkStateHash stateHash;
+                stateHash.Component = component;
+                stateHash.Slice = (uint16_t)(((tick * slicesPerTick) + i) % sliceCount);
+                Compute(stateHash.Component, stateHash.Slice, &stateHash.Hash);
+                result.push_back(stateHash);
+            }
+        }
+        return result;
+    }
+
+    bool Compute(uint8_t component, uint16_t slice, uint32_t* outHash)
+    {
+        if (slice >= GetSliceCount(component))
+        {
+            return false;
+        }
+
+        switch (component)
+        {
+            case NETWORK_STATE_COMPONENT_TILE_ELEMENTS:
+                *outHash = HashTileRegion(slice);
+                break;
+            case NETWORK_STATE_COMPONENT_RIDES:
+                *outHash = HashRides(slice);
+                break;
+            case NETWORK_STATE_COMPONENT_PEEPS:
+                *outHash = HashSprites(slice, SPRITE_IDENTIFIER_PEEP);
+                break;
+            case NETWORK_STATE_COMPONENT_VEHICLES:
+                *outHash = HashSprites(slice, SPRITE_IDENTIFIER_VEHICLE);
+                break;
+            case NETWORK_STATE_COMPONENT_FINANCES:
+                *outHash = HashFinances();
+                break;
+            default:
+                return false;
+        }
+        return true;
+    }
+
+    std::string GetSliceDescription(uint8_t component, uint16_t slice)
+    {
+        switch (component)
+        {
+            case NETWORK_STATE_COMPONENT_TILE_ELEMENTS:
+            {
+                int32_t regionsPerRow = std::max(1, GetTileRegionsPerRow());
+                int32_t x = (slice % regionsPerRow) * TILE_REGION_SIZE;
+                int32_t y = (slice / regionsPerRow) * TILE_REGION_SIZE;
+                return String::StdFormat(
+                    "tile elements (x %d-%d, y %d-%d)", x, x + TILE_REGION_SIZE - 1, y, y + TILE_REGION_SIZE - 1);
+            }
+            case NETWORK_STATE_COMPONENT_RIDES:
+                return String::StdFormat(
+                    "rides (%d-%d)", slice * RIDES_PER_SLICE, std::min((slice + 1) * RIDES_PER_SLICE, MAX_RIDES) - 1);
+            case NETWORK_STATE_COMPONENT_PEEPS:
+                return String::StdFormat(
+                    "peeps (sprites %d-%d)", slice * SPRITES_PER_SLICE, (slice + 1) * SPRITES_PER_SLICE - 1);
+            case NETWORK_STATE_COMPONENT_VEHICLES:
+                return String::StdFormat(
+                    "vehicles (sprites %d-%d)", slice * SPRITES_PER_SLICE, (slice + 1) * SPRITES_PER_SLICE - 1);
+            case NETWORK_STATE_COMPONENT_FINANCES:
+                return "park finances";
+            default:
+                return String::StdFormat("unknown component %u", component);
+        }
+    }
+} // namespace NetworkStateHashes
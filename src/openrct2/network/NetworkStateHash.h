@@ -0,0 +1,47 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2018 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../common.h"
+
+#include <string>
+#include <vector>
+
+enum NETWORK_STATE_COMPONENT : uint8_t
+{
+    NETWORK_STATE_COMPONENT_TILE_ELEMENTS,
+    NETWORK_STATE_COMPONENT_RIDES,
+    NETWORK_STATE_COMPONENT_PEEPS,
+    NETWORK_STATE_COMPONENT_VEHICLES,
+    NETWORK_STATE_COMPONENT_FINANCES,
+    NETWORK_STATE_COMPONENT_COUNT,
+};
+
+/**
+ * A hash of one slice of a game state component, e.g. the tile elements of one map region.
+ */
+struct NetworkStateHash
+{
+    uint8_t Component = 0;
+    uint16_t Slice = 0;
+    uint32_t Hash = 0;
+};
+
+/**
+ * Cheap per-subsystem hashes of the game state used to narrow down where a desync started.
+ * Each component is split into slices and only a few slices are hashed per tick, rotating
+ * deterministically with the tick number so the whole state is covered within a few seconds.
+ */
+namespace NetworkStateHashes
+{
+    std::vector<NetworkStateHash> Create(uint32_t tick);
+    bool Compute(uint8_t component, uint16_t slice, uint32_t* outHash);
+    std::string GetSliceDescription(uint8_t component, uint16_t slice);
+} // namespace NetworkStateHashes
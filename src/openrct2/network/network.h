@@ -61,6 +61,7 @@ namespace OpenRCT2
 #    include "NetworkKey.h"
 #    include "NetworkPacket.h"
 #    include "NetworkPlayer.h"
+#    include "NetworkStateHash.h"
 #    include "NetworkServerAdvertiser.h"
 #    include "NetworkUser.h"
 #    include "TcpSocket.h"
@@ -76,6 +77,7 @@ namespace OpenRCT2
 enum
 {
     NETWORK_TICK_FLAG_CHECKSUMS = 1 << 0,
+    NETWORK_TICK_FLAG_STATE_HASHES = 1 << 1,
 };
 
 struct ObjectRepositoryItem;
@@ -106,6 +108,7 @@ public:
     static const char* FormatChat(NetworkPlayer* fromplayer, const char* text);
     void SendPacketToClients(NetworkPacket& packet, bool front = false, bool gameCmd = false);
     bool CheckSRAND(uint32_t tick, uint32_t srand0);
+    void CheckStateHashes(uint32_t tick);
     void CheckDesynchronizaton();
     void KickPlayer(int32_t playerId);
     void SetPassword(const char* password);
@@ -252,12 +255,14 @@ private:
     uint32_t server_srand0 = 0;
     uint32_t server_srand0_tick = 0;
     std::string server_sprite_hash;
+    std::vector<NetworkStateHash> server_state_hashes;
     uint8_t player_id = 0;
     std::list<std::unique_ptr<NetworkConnection>> client_connection_list;
     std::multiset<GameCommand> game_command_queue;
     std::vector<uint8_t> chunk_buffer;
     std::string _password;
     bool _desynchronised = false;
+    std::string _stateDivergence;
     INetworkServerAdvertiser* _advertiser = nullptr;
     uint32_t server_connect_time = 0;
     uint8_t default_group = 0;
@@ -65,7 +65,7 @@ void FootpathItemObject::Load()
 {
     GetStringTable().Sort();
     _legacyType.name = language_allocate_object_string(GetName());
-    _legacyType.image = gfx_object_allocate_images(GetImageTable().GetImages(), GetImageTable().GetCount());
+    _legacyType.image = GetImageTable().Allocate();
 
     _legacyType.path_bit.scenery_tab_id = 0xFF;
 }
@@ -17,17 +17,6 @@
 #include <memory>
 #include <stdexcept>
 
-ImageTable::~ImageTable()
-{
-    if (_data == nullptr)
-    {
-        for (auto& entry : _entries)
-        {
-            delete[] entry.offset;
-        }
-    }
-}
-
 void ImageTable::Read(IReadObjectContext* context, IStream* stream)
 {
     if (gOpenRCT2NoGraphics)
@@ -41,6 +30,17 @@ void ImageTable::Read(IReadObjectContext* context, IStream* stream)
         uint32_t imageDataSize = stream->ReadValue<uint32_t>();
 
         uint64_t headerTableSize = numImages * 16;
+        if (!context->ShouldLoadImages())
+        {
+            // The image table is the last part of the object, so there is nothing left to read. Only check that the
+            // element headers are all there, as a truncated table would otherwise fail to load later on.
+            if (stream->GetLength() - stream->GetPosition() < headerTableSize)
+            {
+                throw IOException("Image table is truncated.");
+            }
+            return;
+        }
+
         uint64_t remainingBytes = stream->GetLength() - stream->GetPosition() - headerTableSize;
         if (remainingBytes > imageDataSize)
         {
@@ -107,8 +107,47 @@ void ImageTable::AddImage(const rct_g1_element* g1)
     }
     else
     {
-        newg1.offset = new uint8_t[length];
-        std::copy_n(g1->offset, length, newg1.offset);
+        auto data = std::make_unique<uint8_t[]>(length);
+        std::copy_n(g1->offset, length, data.get());
+        newg1.offset = data.get();
+        _ownedData.push_back(std::move(data));
     }
     _entries.push_back(newg1);
 }
+
+void ImageTable::AddImage(const rct_g1_element* g1, const std::shared_ptr<const void>& owner)
+{
+    if (g1->offset != nullptr && (_sharedData.empty() || _sharedData.back() != owner))
+    {
+        _sharedData.push_back(owner);
+    }
+    _entries.push_back(*g1);
+}
+
+void ImageTable::SetDeferred(uint32_t count, std::function<void(ImageTable&)> load)
+{
+    _deferredCount = count;
+    _deferredLoad = std::move(load);
+}
+
+uint32_t ImageTable::Allocate()
+{
+    if (_deferredLoad)
+    {
+        return gfx_object_allocate_images_deferred(_deferredCount, [this]() { return LoadDeferred(); });
+    }
+    return gfx_object_allocate_images(GetImages(), GetCount());
+}
+
+const rct_g1_element* ImageTable::LoadDeferred()
+{
+    // Images may already be loaded if the object has been loaded before
+    if (_entries.empty())
+    {
+        _deferredLoad(*this);
+    }
+
+    // Allocated image ids are based on the count, so always provide exactly that many
+    _entries.resize(_deferredCount);
+    return _entries.data();
+}
@@ -12,6 +12,7 @@
 #include "../common.h"
 #include "../drawing/Drawing.h"
 
+#include <functional>
 #include <memory>
 #include <vector>
 
@@ -23,12 +24,19 @@ class ImageTable
 private:
     std::unique_ptr<uint8_t[]> _data;
     std::vector<rct_g1_element> _entries;
+    // Pixel data of images added with AddImage, either copied or shared with another owner
+    std::vector<std::unique_ptr<uint8_t[]>> _ownedData;
+    std::vector<std::shared_ptr<const void>> _sharedData;
+    // Reads the images the first time one of them is drawn instead of when the object is read
+    std::function<void(ImageTable&)> _deferredLoad;
+    uint32_t _deferredCount = 0;
+
+    const rct_g1_element* LoadDeferred();
 
 public:
     ImageTable() = default;
     ImageTable(const ImageTable&) = delete;
     ImageTable& operator=(const ImageTable&) = delete;
-    ~ImageTable();
 
     void Read(IReadObjectContext* context, IStream* stream);
     const rct_g1_element* GetImages() const
@@ -37,7 +45,19 @@ public:
     }
     uint32_t GetCount() const
     {
-        return (uint32_t)_entries.size();
+        return _deferredLoad ? _deferredCount : (uint32_t)_entries.size();
     }
+    /**
+     * Defers reading the images until they are first needed, count has to be the number of images load will add.
+     */
+    void SetDeferred(uint32_t count, std::function<void(ImageTable&)> load);
+    /**
+     * Allocates image ids for the images and returns the first one.
+     */
+    uint32_t Allocate();
     void AddImage(const rct_g1_element* g1);
+    /**
+     * Adds an image without copying its pixel data, the data is kept alive by holding on to owner instead.
+     */
+    void AddImage(const rct_g1_element* g1, const std::shared_ptr<const void>& owner);
 };
@@ -70,7 +70,7 @@ void LargeSceneryObject::Load()
 {
     GetStringTable().Sort();
     _legacyType.name = language_allocate_object_string(GetName());
-    _baseImageId = gfx_object_allocate_images(GetImageTable().GetImages(), GetImageTable().GetCount());
+    _baseImageId = GetImageTable().Allocate();
     _legacyType.image = _baseImageId;
 
     _legacyType.large_scenery.tiles = _tiles.data();
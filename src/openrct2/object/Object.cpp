@@ -93,6 +93,11 @@ void Object::SetSourceGames(const std::vector<uint8_t>& sourceGames)
     _sourceGames = sourceGames;
 }
 
+void Object::SetDeferredImages(uint32_t count, std::function<void(ImageTable&)> load)
+{
+    _imageTable.SetDeferred(count, std::move(load));
+}
+
 bool Object::IsOpenRCT2OfficialObject()
 {
     static const char _openRCT2OfficialObjects[][9] = {
@@ -217,6 +217,7 @@ public:
     }
     std::vector<uint8_t> GetSourceGames();
     void SetSourceGames(const std::vector<uint8_t>& sourceGames);
+    void SetDeferredImages(uint32_t count, std::function<void(ImageTable&)> load);
 
     const ImageTable& GetImageTable() const
     {
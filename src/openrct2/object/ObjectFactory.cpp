@@ -27,6 +27,7 @@
 #include "LargeSceneryObject.h"
 #include "Object.h"
 #include "ObjectLimits.h"
+#include "ObjectJsonHelpers.h"
 #include "ObjectList.h"
 #include "RideObject.h"
 #include "SceneryGroupObject.h"
@@ -153,7 +154,7 @@ public:
 namespace ObjectFactory
 {
     static Object* CreateObjectFromJson(
-        IObjectRepository& objectRepository, const json_t* jRoot, const IFileDataRetriever* fileRetriever);
+        IObjectRepository& objectRepository, const json_t* jRoot, const IFileDataRetriever* fileRetriever, bool loadImages);
 
     static uint8_t ParseSourceGame(const std::string& s)
     {
@@ -188,7 +189,7 @@ namespace ObjectFactory
         }
     }
 
-    Object* CreateObjectFromLegacyFile(IObjectRepository& objectRepository, const utf8* path)
+    Object* CreateObjectFromLegacyFile(IObjectRepository& objectRepository, const utf8* path, bool loadImages)
     {
         log_verbose("CreateObjectFromLegacyFile(..., \"%s\")", path);
 
@@ -212,7 +213,8 @@ namespace ObjectFactory
                 log_verbose("  size: %zu", chunk->GetLength());
 
                 auto chunkStream = MemoryStream(chunk->GetData(), chunk->GetLength());
-                auto readContext = ReadObjectContext(objectRepository, objectName, !gOpenRCT2NoGraphics, nullptr);
+                auto readContext = ReadObjectContext(
+                    objectRepository, objectName, loadImages && !gOpenRCT2NoGraphics, nullptr);
                 ReadObjectLegacy(result, &readContext, &chunkStream);
                 if (readContext.WasError())
                 {
@@ -328,27 +330,82 @@ namespace ObjectFactory
         return 0xFF;
     }
 
-    Object* CreateObjectFromZipFile(IObjectRepository& objectRepository, const std::string_view& path)
+    static json_t* ReadJsonFromZip(const IZipArchive& archive)
     {
-        Object* result = nullptr;
-        try
+        auto jsonBytes = archive.GetFileData("object.json");
+        if (jsonBytes.empty())
         {
-            auto archive = Zip::Open(path, ZIP_ACCESS::READ);
-            auto jsonBytes = archive->GetFileData("object.json");
-            if (jsonBytes.empty())
+            throw std::runtime_error("Unable to open object.json.");
+        }
+
+        json_error_t jsonLoadError;
+        auto jRoot = json_loadb((const char*)jsonBytes.data(), jsonBytes.size(), 0, &jsonLoadError);
+        if (jRoot == nullptr)
+        {
+            throw JsonException(&jsonLoadError);
+        }
+        return jRoot;
+    }
+
+    /**
+     * Defers loading the images of a JSON object until they are first drawn, the object file is read again at that point.
+     */
+    static void DeferJsonImages(
+        IObjectRepository& objectRepository, Object* object, const json_t* jRoot, const std::string& path, bool isZip)
+    {
+        // Objects that create their images while reading, e.g. water palettes, are left as they are
+        auto count = ObjectJsonHelpers::GetImageCount(jRoot);
+        if (count == 0 || static_cast<const Object*>(object)->GetImageTable().GetCount() != 0)
+        {
+            return;
+        }
+
+        auto id = String::ToStd(json_string_value(json_object_get(jRoot, "id")));
+        object->SetDeferredImages(count, [&objectRepository, path, isZip, id](ImageTable& table) {
+            log_verbose("Loading deferred images of \"%s\"", id.c_str());
+            try
             {
-                throw std::runtime_error("Unable to open object.json.");
+                json_t* jImagesRoot;
+                if (isZip)
+                {
+                    auto archive = Zip::Open(path, ZIP_ACCESS::READ);
+                    jImagesRoot = ReadJsonFromZip(*archive);
+                    auto fileDataRetriever = ZipDataRetriever(*archive);
+                    auto readContext = ReadObjectContext(objectRepository, id, true, &fileDataRetriever);
+                    ObjectJsonHelpers::LoadImages(&readContext, jImagesRoot, table);
+                }
+                else
+                {
+                    jImagesRoot = Json::ReadFromFile(path.c_str());
+                    auto fileDataRetriever = FileSystemDataRetriever(Path::GetDirectory(path));
+                    auto readContext = ReadObjectContext(objectRepository, id, true, &fileDataRetriever);
+                    ObjectJsonHelpers::LoadImages(&readContext, jImagesRoot, table);
+                }
+                json_decref(jImagesRoot);
             }
-
-            json_error_t jsonLoadError;
-            auto jRoot = json_loadb((const char*)jsonBytes.data(), jsonBytes.size(), 0, &jsonLoadError);
-            if (jRoot == nullptr)
+            catch (const std::exception& e)
             {
-                throw JsonException(&jsonLoadError);
+                Console::Error::WriteLine("Unable to load images of '%s': %s", path.c_str(), e.what());
             }
+        });
+    }
+
+    Object* CreateObjectFromZipFile(IObjectRepository& objectRepository, const std::string_view& path, bool loadImages)
+    {
+        Object* result = nullptr;
+        try
+        {
+            auto archive = Zip::Open(path, ZIP_ACCESS::READ);
+            auto jRoot = ReadJsonFromZip(*archive);
 
+            // Images are only read once they are needed
             auto fileDataRetriever = ZipDataRetriever(*archive);
-            return CreateObjectFromJson(objectRepository, jRoot, &fileDataRetriever);
+            result = CreateObjectFromJson(objectRepository, jRoot, &fileDataRetriever, false);
+            if (result != nullptr && loadImages && !gOpenRCT2NoGraphics)
+            {
+                DeferJsonImages(objectRepository, result, jRoot, std::string(path), true);
+            }
+            json_decref(jRoot);
         }
         catch (const std::exception& e)
         {
@@ -360,7 +417,7 @@ namespace ObjectFactory
         return result;
     }
 
-    Object* CreateObjectFromJsonFile(IObjectRepository& objectRepository, const std::string& path)
+    Object* CreateObjectFromJsonFile(IObjectRepository& objectRepository, const std::string& path, bool loadImages)
     {
         log_verbose("CreateObjectFromJsonFile(\"%s\")", path.c_str());
 
@@ -368,8 +425,14 @@ namespace ObjectFactory
         try
         {
             auto jRoot = Json::ReadFromFile(path.c_str());
+
+            // Images are only read once they are needed
             auto fileDataRetriever = FileSystemDataRetriever(Path::GetDirectory(path));
-            result = CreateObjectFromJson(objectRepository, jRoot, &fileDataRetriever);
+            result = CreateObjectFromJson(objectRepository, jRoot, &fileDataRetriever, false);
+            if (result != nullptr && loadImages && !gOpenRCT2NoGraphics)
+            {
+                DeferJsonImages(objectRepository, result, jRoot, path, false);
+            }
             json_decref(jRoot);
         }
         catch (const std::runtime_error& err)
@@ -383,7 +446,7 @@ namespace ObjectFactory
     }
 
     Object* CreateObjectFromJson(
-        IObjectRepository& objectRepository, const json_t* jRoot, const IFileDataRetriever* fileRetriever)
+        IObjectRepository& objectRepository, const json_t* jRoot, const IFileDataRetriever* fileRetriever, bool loadImages)
     {
         log_verbose("CreateObjectFromJson(...)");
 
@@ -409,7 +472,7 @@ namespace ObjectFactory
                 memcpy(entry.name, originalName.c_str(), minLength);
 
                 result = CreateObject(entry);
-                auto readContext = ReadObjectContext(objectRepository, id, !gOpenRCT2NoGraphics, fileRetriever);
+                auto readContext = ReadObjectContext(objectRepository, id, loadImages && !gOpenRCT2NoGraphics, fileRetriever);
                 result->ReadJson(&readContext, jRoot);
                 if (readContext.WasError())
                 {
@@ -19,11 +19,13 @@ struct rct_object_entry;
 
 namespace ObjectFactory
 {
-    Object* CreateObjectFromLegacyFile(IObjectRepository& objectRepository, const utf8* path);
+    // When loadImages is false only the headers and strings are read, which is all the object repository index needs
+    Object* CreateObjectFromLegacyFile(IObjectRepository& objectRepository, const utf8* path, bool loadImages = true);
     Object* CreateObjectFromLegacyData(
         IObjectRepository& objectRepository, const rct_object_entry* entry, const void* data, size_t dataSize);
-    Object* CreateObjectFromZipFile(IObjectRepository& objectRepository, const std::string_view& path);
+    Object* CreateObjectFromZipFile(
+        IObjectRepository& objectRepository, const std::string_view& path, bool loadImages = true);
     Object* CreateObject(const rct_object_entry& entry);
 
-    Object* CreateObjectFromJsonFile(IObjectRepository& objectRepository, const std::string& path);
+    Object* CreateObjectFromJsonFile(IObjectRepository& objectRepository, const std::string& path, bool loadImages = true);
 } // namespace ObjectFactory
@@ -28,6 +28,8 @@
 #include <algorithm>
 #include <cstdlib>
 #include <cstring>
+#include <memory>
+#include <mutex>
 #include <unordered_map>
 
 using namespace OpenRCT2;
@@ -192,6 +194,21 @@ namespace ObjectJsonHelpers
         return result;
     }
 
+    // File names of the RCT2 objects, found by a single scan of the objects directory the first time one is needed
+    static std::unordered_map<std::string, std::string> _legacyObjectPaths;
+    static bool _legacyObjectPathsScanned = false;
+    static std::mutex _legacyObjectPathsMutex;
+
+    // Legacy objects whose images are in use by JSON objects, so that they are only loaded once. Each entry has its own
+    // mutex so that different objects can be loaded at the same time, the map mutex is only held to find an entry.
+    struct LegacyObjectCacheEntry
+    {
+        std::mutex Mutex;
+        std::weak_ptr<Object> LoadedObject;
+    };
+    static std::unordered_map<std::string, std::shared_ptr<LegacyObjectCacheEntry>> _legacyObjects;
+    static std::mutex _legacyObjectsMutex;
+
     static std::string FindLegacyObject(const std::string& name)
     {
         const auto env = GetContext()->GetPlatformEnvironment();
@@ -199,31 +216,80 @@ namespace ObjectJsonHelpers
         auto objectPath = Path::Combine(objectsPath, name);
         if (!File::Exists(objectPath))
         {
-            // Search recursively for any file with the target name (case insensitive)
-            auto filter = Path::Combine(objectsPath, "*.dat");
-            auto scanner = std::unique_ptr<IFileScanner>(Path::ScanDirectory(filter, true));
-            while (scanner->Next())
+            std::lock_guard<std::mutex> lock(_legacyObjectPathsMutex);
+            if (!_legacyObjectPathsScanned)
             {
-                auto currentName = Path::GetFileName(scanner->GetPathRelative());
-                if (String::Equals(currentName, name, true))
+                // Index every file recursively by its name (case insensitive), the first one found takes precedence
+                auto filter = Path::Combine(objectsPath, "*.dat");
+                auto scanner = std::unique_ptr<IFileScanner>(Path::ScanDirectory(filter, true));
+                while (scanner->Next())
                 {
-                    objectPath = scanner->GetPath();
-                    break;
+                    auto currentName = String::ToUpper(Path::GetFileName(scanner->GetPathRelative()));
+                    _legacyObjectPaths.emplace(currentName, scanner->GetPath());
                 }
+                _legacyObjectPathsScanned = true;
+            }
+
+            auto found = _legacyObjectPaths.find(String::ToUpper(name));
+            if (found != _legacyObjectPaths.end())
+            {
+                objectPath = found->second;
             }
         }
         return objectPath;
     }
 
-    static std::vector<rct_g1_element> LoadObjectImages(
-        IReadObjectContext* context, const std::string& name, const std::vector<int32_t>& range)
+    static std::shared_ptr<Object> GetLegacyObject(IReadObjectContext* context, const std::string& path)
+    {
+        std::shared_ptr<LegacyObjectCacheEntry> entry;
+        {
+            std::lock_guard<std::mutex> lock(_legacyObjectsMutex);
+            auto& cached = _legacyObjects[path];
+            if (cached == nullptr)
+            {
+                cached = std::make_shared<LegacyObjectCacheEntry>();
+            }
+            entry = cached;
+        }
+
+        // Anyone else asking for the same object waits here until it has been loaded
+        std::lock_guard<std::mutex> lock(entry->Mutex);
+        auto result = entry->LoadedObject.lock();
+        if (result == nullptr)
+        {
+            result = std::shared_ptr<Object>(
+                ObjectFactory::CreateObjectFromLegacyFile(context->GetObjectRepository(), path.c_str()));
+            entry->LoadedObject = result;
+        }
+        return result;
+    }
+
+    void ClearLegacyObjectCache()
+    {
+        {
+            std::lock_guard<std::mutex> lock(_legacyObjectPathsMutex);
+            _legacyObjectPaths.clear();
+            _legacyObjectPathsScanned = false;
+        }
+        {
+            // Objects still in use stay loaded, they are owned by the image tables that use them
+            std::lock_guard<std::mutex> lock(_legacyObjectsMutex);
+            _legacyObjects.clear();
+        }
+    }
+
+    /**
+     * Adds images of an RCT2 object to the image table. The pixel data is shared with the legacy object, which is kept
+     * loaded for as long as any image table uses it.
+     */
+    static void LoadObjectImages(
+        IReadObjectContext* context, const std::string& name, const std::vector<int32_t>& range, ImageTable& imageTable)
     {
-        std::vector<rct_g1_element> result;
         auto objectPath = FindLegacyObject(name);
-        auto obj = ObjectFactory::CreateObjectFromLegacyFile(context->GetObjectRepository(), objectPath.c_str());
+        auto obj = GetLegacyObject(context, objectPath);
         if (obj != nullptr)
         {
-            auto& imgTable = static_cast<const Object*>(obj)->GetImageTable();
+            auto& imgTable = static_cast<const Object*>(obj.get())->GetImageTable();
             auto numImages = (int32_t)imgTable.GetCount();
             auto images = imgTable.GetImages();
             size_t placeHoldersAdded = 0;
@@ -231,21 +297,15 @@ namespace ObjectJsonHelpers
             {
                 if (i >= 0 && i < numImages)
                 {
-                    auto& objg1 = images[i];
-                    auto length = g1_calculate_data_size(&objg1);
-                    auto g1 = objg1;
-                    g1.offset = (uint8_t*)std::malloc(length);
-                    std::memcpy(g1.offset, objg1.offset, length);
-                    result.push_back(g1);
+                    imageTable.AddImage(&images[i], obj);
                 }
                 else
                 {
                     auto g1 = rct_g1_element{};
-                    result.push_back(g1);
+                    imageTable.AddImage(&g1);
                     placeHoldersAdded++;
                 }
             }
-            delete obj;
 
             // Log place holder information
             if (placeHoldersAdded > 0)
@@ -258,9 +318,12 @@ namespace ObjectJsonHelpers
         {
             std::string msg = "Unable to open '" + objectPath + "'";
             context->LogWarning(OBJECT_ERROR_INVALID_PROPERTY, msg.c_str());
-            result.resize(range.size());
+            for (size_t i = 0; i < range.size(); i++)
+            {
+                auto g1 = rct_g1_element{};
+                imageTable.AddImage(&g1);
+            }
         }
-        return result;
     }
 
     static std::vector<rct_g1_element> ParseImages(IReadObjectContext* context, std::string s)
@@ -314,18 +377,6 @@ namespace ObjectJsonHelpers
                 }
             }
         }
-        else if (String::StartsWith(s, "$RCT2:OBJDATA/"))
-        {
-            auto name = s.substr(14);
-            auto rangeStart = name.find('[');
-            if (rangeStart != std::string::npos)
-            {
-                auto rangeString = name.substr(rangeStart);
-                auto range = ParseRange(name.substr(rangeStart));
-                name = name.substr(0, rangeStart);
-                result = LoadObjectImages(context, name, range);
-            }
-        }
         else
         {
             try
@@ -386,6 +437,25 @@ namespace ObjectJsonHelpers
         return result;
     }
 
+    static size_t GetImageCount(const std::string& s)
+    {
+        if (String::StartsWith(s, "$CSG"))
+        {
+            return is_csg_loaded() ? ParseRange(s.substr(4)).size() : 0;
+        }
+        if (String::StartsWith(s, "$G1"))
+        {
+            return ParseRange(s.substr(3)).size();
+        }
+        if (String::StartsWith(s, "$RCT2:OBJDATA/"))
+        {
+            auto rangeStart = s.find('[');
+            return rangeStart != std::string::npos ? ParseRange(s.substr(rangeStart)).size() : 0;
+        }
+        // An image file, or a placeholder if the string is empty or the file can not be loaded
+        return 1;
+    }
+
     static uint8_t ParseStringId(const std::string& s)
     {
         if (s == "name")
@@ -437,7 +507,19 @@ namespace ObjectJsonHelpers
                 std::vector<rct_g1_element> images;
                 if (json_is_string(el))
                 {
-                    auto s = json_string_value(el);
+                    std::string s = json_string_value(el);
+                    if (String::StartsWith(s, "$RCT2:OBJDATA/"))
+                    {
+                        auto name = s.substr(14);
+                        auto rangeStart = name.find('[');
+                        if (rangeStart != std::string::npos)
+                        {
+                            auto range = ParseRange(name.substr(rangeStart));
+                            name = name.substr(0, rangeStart);
+                            LoadObjectImages(context, name, range, imageTable);
+                        }
+                        continue;
+                    }
                     images = ParseImages(context, s);
                 }
                 else if (json_is_object(el))
@@ -452,4 +534,24 @@ namespace ObjectJsonHelpers
             }
         }
     }
+
+    uint32_t GetImageCount(const json_t* root)
+    {
+        size_t count = 0;
+        auto jsonImages = json_object_get(root, "images");
+        size_t i;
+        json_t* el;
+        json_array_foreach(jsonImages, i, el)
+        {
+            if (json_is_string(el))
+            {
+                count += GetImageCount(json_string_value(el));
+            }
+            else if (json_is_object(el))
+            {
+                count++;
+            }
+        }
+        return (uint32_t)count;
+    }
 } // namespace ObjectJsonHelpers
@@ -34,6 +34,14 @@ namespace ObjectJsonHelpers
     rct_object_entry ParseObjectEntry(const std::string& s);
     void LoadStrings(const json_t* root, StringTable& stringTable);
     void LoadImages(IReadObjectContext* context, const json_t* root, ImageTable& imageTable);
+    /**
+     * Gets the number of images LoadImages adds for the object, without loading any of them.
+     */
+    uint32_t GetImageCount(const json_t* root);
+    /**
+     * Forgets the RCT2 object files and objects found by LoadImages, so that they are looked up again next time.
+     */
+    void ClearLegacyObjectCache();
 
     template<typename T> static T GetFlags(const json_t* obj, std::initializer_list<std::pair<std::string, T>> list)
     {
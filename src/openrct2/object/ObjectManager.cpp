@@ -17,6 +17,7 @@
 #include "FootpathItemObject.h"
 #include "LargeSceneryObject.h"
 #include "Object.h"
+#include "ObjectJsonHelpers.h"
 #include "ObjectList.h"
 #include "ObjectRepository.h"
 #include "SceneryGroupObject.h"
@@ -177,6 +178,7 @@ public:
         {
             UnloadObject(object);
         }
+        ObjectJsonHelpers::ClearLegacyObjectCache();
         UpdateSceneryGroupIndexes();
         ResetTypeToRideEntryIndexMap();
     }
@@ -33,6 +33,7 @@
 #include "../util/Util.h"
 #include "Object.h"
 #include "ObjectFactory.h"
+#include "ObjectJsonHelpers.h"
 #include "ObjectList.h"
 #include "ObjectManager.h"
 #include "RideObject.h"
@@ -67,11 +68,131 @@ struct ObjectEntryEqual
 
 using ObjectEntryMap = std::unordered_map<rct_object_entry, size_t, ObjectEntryHash, ObjectEntryEqual>;
 
+#pragma pack(push, 1)
+struct ObjectIndexPoolRange
+{
+    uint32_t Offset;
+    uint32_t Length;
+};
+assert_struct_size(ObjectIndexPoolRange, 8);
+
+struct ObjectIndexRecord
+{
+    rct_object_entry ObjectEntry;
+    ObjectIndexPoolRange Path;
+    ObjectIndexPoolRange Name;
+    ObjectIndexPoolRange Sources;
+    ObjectIndexPoolRange SceneryGroupEntries;
+    uint8_t RideFlags;
+    uint8_t RideCategory[MAX_CATEGORIES_PER_RIDE];
+    uint8_t RideType[MAX_RIDE_TYPES_PER_RIDE_ENTRY];
+    uint8_t RideGroupIndex;
+};
+assert_struct_size(ObjectIndexRecord, 0x10 + 4 * 8 + 2 + MAX_CATEGORIES_PER_RIDE + MAX_RIDE_TYPES_PER_RIDE_ENTRY);
+#pragma pack(pop)
+
+static ObjectIndexPoolRange WritePoolData(MemoryStream& pool, const void* data, size_t length)
+{
+    ObjectIndexPoolRange range;
+    range.Offset = (uint32_t)pool.GetLength();
+    range.Length = (uint32_t)length;
+    pool.Write(data, length);
+    return range;
+}
+
+static const uint8_t* GetPoolData(const uint8_t* pool, size_t poolLength, const ObjectIndexPoolRange& range)
+{
+    if (range.Offset > poolLength || range.Length > poolLength - range.Offset)
+    {
+        throw IOException("Object index refers to data outside of the file.");
+    }
+    return pool + range.Offset;
+}
+
+void WriteObjectIndexItems(IStream* stream, const std::vector<ObjectRepositoryItem>& items)
+{
+    std::vector<ObjectIndexRecord> records(items.size());
+    MemoryStream pool;
+    for (size_t i = 0; i < items.size(); i++)
+    {
+        const auto& item = items[i];
+        auto& record = records[i];
+        record = {};
+        record.ObjectEntry = item.ObjectEntry;
+        record.Path = WritePoolData(pool, item.Path.data(), item.Path.size());
+        record.Name = WritePoolData(pool, item.Name.data(), item.Name.size());
+        record.Sources = WritePoolData(pool, item.Sources.data(), item.Sources.size());
+
+        switch (object_entry_get_type(&item.ObjectEntry))
+        {
+            case OBJECT_TYPE_RIDE:
+                record.RideFlags = item.RideInfo.RideFlags;
+                std::copy_n(item.RideInfo.RideCategory, MAX_CATEGORIES_PER_RIDE, record.RideCategory);
+                std::copy_n(item.RideInfo.RideType, MAX_RIDE_TYPES_PER_RIDE_ENTRY, record.RideType);
+                record.RideGroupIndex = item.RideInfo.RideGroupIndex;
+                break;
+            case OBJECT_TYPE_SCENERY_GROUP:
+            {
+                const auto& entries = item.SceneryGroupInfo.Entries;
+                record.SceneryGroupEntries = WritePoolData(pool, entries.data(), entries.size() * sizeof(rct_object_entry));
+                break;
+            }
+        }
+    }
+
+    stream->Write(records.data(), records.size() * sizeof(ObjectIndexRecord));
+    stream->Write(pool.GetData(), pool.GetLength());
+}
+
+std::vector<ObjectRepositoryItem> ReadObjectIndexItems(const uint8_t* data, size_t length, uint32_t numItems)
+{
+    if (length / sizeof(ObjectIndexRecord) < numItems)
+    {
+        throw IOException("Object index is truncated.");
+    }
+    auto records = (const ObjectIndexRecord*)data;
+    auto pool = data + numItems * sizeof(ObjectIndexRecord);
+    size_t poolLength = length - numItems * sizeof(ObjectIndexRecord);
+
+    std::vector<ObjectRepositoryItem> items(numItems);
+    for (uint32_t i = 0; i < numItems; i++)
+    {
+        const auto& record = records[i];
+        auto& item = items[i];
+        item.ObjectEntry = record.ObjectEntry;
+
+        auto path = GetPoolData(pool, poolLength, record.Path);
+        item.Path.assign((const char*)path, record.Path.Length);
+        auto name = GetPoolData(pool, poolLength, record.Name);
+        item.Name.assign((const char*)name, record.Name.Length);
+        auto sources = GetPoolData(pool, poolLength, record.Sources);
+        item.Sources.assign(sources, sources + record.Sources.Length);
+
+        switch (object_entry_get_type(&item.ObjectEntry))
+        {
+            case OBJECT_TYPE_RIDE:
+                item.RideInfo.RideFlags = record.RideFlags;
+                std::copy_n(record.RideCategory, MAX_CATEGORIES_PER_RIDE, item.RideInfo.RideCategory);
+                std::copy_n(record.RideType, MAX_RIDE_TYPES_PER_RIDE_ENTRY, item.RideInfo.RideType);
+                item.RideInfo.RideGroupIndex = record.RideGroupIndex;
+                break;
+            case OBJECT_TYPE_SCENERY_GROUP:
+            {
+                auto entries = (const rct_object_entry*)GetPoolData(pool, poolLength, record.SceneryGroupEntries);
+                size_t numEntries = record.SceneryGroupEntries.Length / sizeof(rct_object_entry);
+                item.SceneryGroupInfo.Entries.assign(entries, entries + numEntries);
+                break;
+            }
+        }
+    }
+    return items;
+}
+
 class ObjectFileIndex final : public FileIndex<ObjectRepositoryItem>
 {
 private:
     static constexpr uint32_t MAGIC_NUMBER = 0x5844494F; // OIDX
-    static constexpr uint16_t VERSION = 18;
+    static constexpr uint16_t VERSION = 19;
     static constexpr auto PATTERN = "*.dat;*.pob;*.json;*.parkobj";
 
     IObjectRepository& _objectRepository;
@@ -91,19 +212,20 @@ public:
 public:
     std::tuple<bool, ObjectRepositoryItem> Create([[maybe_unused]] int32_t language, const std::string& path) const override
     {
+        // The index only needs the object headers and strings, so skip decoding the images
         Object* object = nullptr;
         auto extension = Path::GetExtension(path);
         if (String::Equals(extension, ".json", true))
         {
-            object = ObjectFactory::CreateObjectFromJsonFile(_objectRepository, path);
+            object = ObjectFactory::CreateObjectFromJsonFile(_objectRepository, path, false);
         }
         else if (String::Equals(extension, ".parkobj", true))
         {
-            object = ObjectFactory::CreateObjectFromZipFile(_objectRepository, path);
+            object = ObjectFactory::CreateObjectFromZipFile(_objectRepository, path, false);
         }
         else
         {
-            object = ObjectFactory::CreateObjectFromLegacyFile(_objectRepository, path.c_str());
+            object = ObjectFactory::CreateObjectFromLegacyFile(_objectRepository, path.c_str(), false);
         }
         if (object != nullptr)
         {
@@ -120,82 +242,14 @@ public:
     }
 
 protected:
-    void Serialise(IStream* stream, const ObjectRepositoryItem& item) const override
+    void WriteItems(IStream* stream, const std::vector<ObjectRepositoryItem>& items) const override
     {
-        stream->WriteValue(item.ObjectEntry);
-        stream->WriteString(item.Path);
-        stream->WriteString(item.Name);
-        uint8_t sourceLength = (uint8_t)item.Sources.size();
-        stream->WriteValue(sourceLength);
-        for (auto source : item.Sources)
-        {
-            stream->WriteValue(source);
-        }
-
-        switch (object_entry_get_type(&item.ObjectEntry))
-        {
-            case OBJECT_TYPE_RIDE:
-                stream->WriteValue<uint8_t>(item.RideInfo.RideFlags);
-                for (int32_t i = 0; i < MAX_CATEGORIES_PER_RIDE; i++)
-                {
-                    stream->WriteValue<uint8_t>(item.RideInfo.RideCategory[i]);
-                }
-                for (int32_t i = 0; i < MAX_RIDE_TYPES_PER_RIDE_ENTRY; i++)
-                {
-                    stream->WriteValue<uint8_t>(item.RideInfo.RideType[i]);
-                }
-                stream->WriteValue<uint8_t>(item.RideInfo.RideGroupIndex);
-                break;
-            case OBJECT_TYPE_SCENERY_GROUP:
-                stream->WriteValue<uint16_t>((uint16_t)item.SceneryGroupInfo.Entries.size());
-                for (const auto& entry : item.SceneryGroupInfo.Entries)
-                {
-                    stream->WriteValue<rct_object_entry>(entry);
-                }
-                break;
-        }
+        WriteObjectIndexItems(stream, items);
     }
 
-    ObjectRepositoryItem Deserialise(IStream* stream) const override
+    std::vector<ObjectRepositoryItem> ReadItems(const uint8_t* data, size_t length, uint32_t numItems) const override
     {
-        ObjectRepositoryItem item;
-
-        item.ObjectEntry = stream->ReadValue<rct_object_entry>();
-        item.Path = stream->ReadStdString();
-        item.Name = stream->ReadStdString();
-        auto sourceLength = stream->ReadValue<uint8_t>();
-        for (size_t i = 0; i < sourceLength; i++)
-        {
-            auto value = stream->ReadValue<uint8_t>();
-            item.Sources.push_back(value);
-        }
-
-        switch (object_entry_get_type(&item.ObjectEntry))
-        {
-            case OBJECT_TYPE_RIDE:
-                item.RideInfo.RideFlags = stream->ReadValue<uint8_t>();
-                for (int32_t i = 0; i < MAX_CATEGORIES_PER_RIDE; i++)
-                {
-                    item.RideInfo.RideCategory[i] = stream->ReadValue<uint8_t>();
-                }
-                for (int32_t i = 0; i < MAX_RIDE_TYPES_PER_RIDE_ENTRY; i++)
-                {
-                    item.RideInfo.RideType[i] = stream->ReadValue<uint8_t>();
-                }
-                item.RideInfo.RideGroupIndex = stream->ReadValue<uint8_t>();
-                break;
-            case OBJECT_TYPE_SCENERY_GROUP:
-            {
-                auto numEntries = stream->ReadValue<uint16_t>();
-                item.SceneryGroupInfo.Entries = std::vector<rct_object_entry>(numEntries);
-                for (size_t i = 0; i < numEntries; i++)
-                {
-                    item.SceneryGroupInfo.Entries[i] = stream->ReadValue<rct_object_entry>();
-                }
-                break;
-            }
-        }
-        return item;
+        return ReadObjectIndexItems(data, length, numItems);
     }
 
 private:
@@ -227,6 +281,7 @@ public:
     void LoadOrConstruct(int32_t language) override
     {
         ClearItems();
+        ObjectJsonHelpers::ClearLegacyObjectCache();
         auto items = _fileIndex.LoadOrBuild(language);
         AddItems(items);
         SortItems();
@@ -234,6 +289,7 @@ public:
 
     void Construct(int32_t language) override
     {
+        ObjectJsonHelpers::ClearLegacyObjectCache();
         auto items = _fileIndex.Rebuild(language);
         AddItems(items);
         SortItems();
@@ -84,6 +84,14 @@ std::unique_ptr<IObjectRepository> CreateObjectRepository(const std::shared_ptr<
 
 bool IsObjectCustom(const ObjectRepositoryItem* object);
 
+/**
+ * Writes the items of the object index as a table of fixed size records followed by a pool holding the strings and
+ * lists the records refer to, so they can be read straight from the mapped index file by ReadObjectIndexItems. Throws
+ * an IOException if the data is truncated or refers outside of itself.
+ */
+void WriteObjectIndexItems(IStream* stream, const std::vector<ObjectRepositoryItem>& items);
+std::vector<ObjectRepositoryItem> ReadObjectIndexItems(const uint8_t* data, size_t length, uint32_t numItems);
+
 size_t object_repository_get_items_count();
 const ObjectRepositoryItem* object_repository_get_items();
 const ObjectRepositoryItem* object_repository_find_object_by_entry(const rct_object_entry* entry);
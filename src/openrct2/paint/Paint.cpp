@@ -18,14 +18,17 @@
 #include "tile_element/Paint.TileElement.h"
 
 #include <algorithm>
+#include <mutex>
 
 // Globals for paint clipping
 uint8_t gClipHeight = 128; // Default to middle value
 LocationXY8 gClipSelectionA = { 0, 0 };
 LocationXY8 gClipSelectionB = { MAXIMUM_MAP_SIZE_TECHNICAL - 1, MAXIMUM_MAP_SIZE_TECHNICAL - 1 };
 
-paint_session gPaintSession;
-static bool _paintSessionInUse;
+// Sessions are pooled so that viewport columns can be painted on several threads at once
+static std::vector<std::unique_ptr<paint_session>> _freePaintSessions;
+static std::mutex _paintSessionMutex;
+std::mutex gPaintTextMutex;
 
 static constexpr const uint8_t BoundBoxDebugColours[] = {
     0,   // NONE
@@ -57,8 +60,9 @@ static uint32_t paint_ps_colourify_image(uint32_t imageId, uint8_t spriteType, u
 static void paint_session_init(paint_session* session, rct_drawpixelinfo* dpi)
 {
     session->DPI = dpi;
-    session->EndOfPaintStructArray = &session->PaintStructs[4000 - 1];
-    session->NextFreePaintStruct = session->PaintStructs;
+    session->PaintEntryChunk = 0;
+    session->NextFreePaintStruct = session->PaintEntries.GetChunk(0);
+    session->EndOfPaintStructArray = session->NextFreePaintStruct + PaintEntryArena::ChunkSize;
     session->UnkF1AD28 = nullptr;
     session->UnkF1AD2C = nullptr;
     for (auto& quadrant : session->Quadrants)
@@ -74,6 +78,20 @@ static void paint_session_init(paint_session* session, rct_drawpixelinfo* dpi)
     session->SurfaceElement = nullptr;
 }
 
+/**
+ * Makes sure NextFreePaintStruct points to a usable entry, moving on to the next chunk of the arena
+ * when the current one is full.
+ */
+static void paint_session_reserve_entry(paint_session* session)
+{
+    if (session->NextFreePaintStruct >= session->EndOfPaintStructArray)
+    {
+        session->PaintEntryChunk++;
+        session->NextFreePaintStruct = session->PaintEntries.GetChunk(session->PaintEntryChunk);
+        session->EndOfPaintStructArray = session->NextFreePaintStruct + PaintEntryArena::ChunkSize;
+    }
+}
+
 static void paint_session_add_ps_to_quadrant(paint_session* session, paint_struct* ps, int32_t positionHash)
 {
     uint32_t paintQuadrantIndex = std::clamp(positionHash / 32, 0, MAX_PAINT_QUADRANTS - 1);
@@ -91,8 +109,7 @@ static void paint_session_add_ps_to_quadrant(paint_session* session, paint_struc
 static paint_struct* sub_9819_c(
     paint_session* session, uint32_t image_id, LocationXYZ16 offset, LocationXYZ16 boundBoxSize, LocationXYZ16 boundBoxOffset)
 {
-    if (session->NextFreePaintStruct >= session->EndOfPaintStructArray)
-        return nullptr;
+    paint_session_reserve_entry(session);
     auto g1 = gfx_get_g1_element(image_id & 0x7FFFF);
     if (g1 == nullptr)
     {
@@ -731,18 +748,28 @@ static void draw_pixel_info_crop_by_zoom(rct_drawpixelinfo* dpi)
 
 paint_session* paint_session_alloc(rct_drawpixelinfo* dpi)
 {
-    // Currently limited to just one session at a time
-    assert(!_paintSessionInUse);
-    _paintSessionInUse = true;
-    paint_session* session = &gPaintSession;
+    std::unique_ptr<paint_session> session;
+    {
+        std::lock_guard<std::mutex> lock(_paintSessionMutex);
+        if (!_freePaintSessions.empty())
+        {
+            session = std::move(_freePaintSessions.back());
+            _freePaintSessions.pop_back();
+        }
+    }
+    if (session == nullptr)
+    {
+        session = std::make_unique<paint_session>();
+    }
 
-    paint_session_init(session, dpi);
-    return session;
+    paint_session_init(session.get(), dpi);
+    return session.release();
 }
 
-void paint_session_free([[maybe_unused]] paint_session* session)
+void paint_session_free(paint_session* session)
 {
-    _paintSessionInUse = false;
+    std::lock_guard<std::mutex> lock(_paintSessionMutex);
+    _freePaintSessions.emplace_back(session);
 }
 
 /**
@@ -767,10 +794,7 @@ paint_struct* sub_98196C(
     session->UnkF1AD28 = nullptr;
     session->UnkF1AD2C = nullptr;
 
-    if (session->NextFreePaintStruct >= session->EndOfPaintStructArray)
-    {
-        return nullptr;
-    }
+    paint_session_reserve_entry(session);
 
     auto g1Element = gfx_get_g1_element(image_id & 0x7FFFF);
     if (g1Element == nullptr)
@@ -1056,10 +1080,7 @@ bool paint_attach_to_previous_attach(paint_session* session, uint32_t image_id,
         return paint_attach_to_previous_ps(session, image_id, x, y);
     }
 
-    if (session->NextFreePaintStruct >= session->EndOfPaintStructArray)
-    {
-        return false;
-    }
+    paint_session_reserve_entry(session);
     attached_paint_struct* ps = &session->NextFreePaintStruct->attached;
     ps->image_id = image_id;
     ps->x = x;
@@ -1088,10 +1109,7 @@ bool paint_attach_to_previous_attach(paint_session* session, uint32_t image_id,
  */
 bool paint_attach_to_previous_ps(paint_session* session, uint32_t image_id, uint16_t x, uint16_t y)
 {
-    if (session->NextFreePaintStruct >= session->EndOfPaintStructArray)
-    {
-        return false;
-    }
+    paint_session_reserve_entry(session);
     attached_paint_struct* ps = &session->NextFreePaintStruct->attached;
 
     ps->image_id = image_id;
@@ -1131,10 +1149,7 @@ void paint_floating_money_effect(
     paint_session* session, money32 amount, rct_string_id string_id, int16_t y, int16_t z, int8_t y_offsets[], int16_t offset_x,
     uint32_t rotation)
 {
-    if (session->NextFreePaintStruct >= session->EndOfPaintStructArray)
-    {
-        return;
-    }
+    paint_session_reserve_entry(session);
 
     paint_string_struct* ps = &session->NextFreePaintStruct->string;
     ps->string_id = string_id;
@@ -14,6 +14,10 @@
 #include "../interface/Colour.h"
 #include "../world/Location.hpp"
 
+#include <memory>
+#include <mutex>
+#include <vector>
+
 struct TileElement;
 
 #pragma pack(push, 1)
@@ -137,10 +141,34 @@ struct tunnel_entry
 #define MAX_PAINT_QUADRANTS 512
 #define TUNNEL_MAX_COUNT 65
 
+/**
+ * Storage for the paint entries of a session. Entries are handed out from fixed size chunks which
+ * are kept between sessions, so a busy view only allocates once and never runs out of entries.
+ */
+class PaintEntryArena
+{
+public:
+    static constexpr size_t ChunkSize = 4000;
+
+private:
+    std::vector<std::unique_ptr<paint_entry[]>> _chunks;
+
+public:
+    paint_entry* GetChunk(size_t index)
+    {
+        while (_chunks.size() <= index)
+        {
+            _chunks.push_back(std::make_unique<paint_entry[]>(ChunkSize));
+        }
+        return _chunks[index].get();
+    }
+};
+
 struct paint_session
 {
     rct_drawpixelinfo* DPI;
-    paint_entry PaintStructs[4000];
+    PaintEntryArena PaintEntries;
+    size_t PaintEntryChunk;
     paint_struct* Quadrants[MAX_PAINT_QUADRANTS];
     paint_struct PaintHead;
     uint32_t QuadrantBackIndex;
@@ -174,7 +202,11 @@ struct paint_session
     uint32_t TrackColours[4];
 };
 
-extern paint_session gPaintSession;
+/**
+ * Held while painting formats or measures text, e.g. for signs and banners, as that uses global buffers and the
+ * scrolling text cache.
+ */
+extern std::mutex gPaintTextMutex;
 
 // Globals for paint clipping
 extern uint8_t gClipHeight;
@@ -96,11 +96,11 @@ static int32_t large_scenery_sign_text_height(const utf8* str, rct_large_scenery
     return height;
 }
 
-static const utf8* large_scenery_sign_fit_text(const utf8* str, rct_large_scenery_text* text, bool height)
+static void large_scenery_sign_fit_text(
+    const utf8* str, rct_large_scenery_text* text, bool height, utf8* fitStr, size_t fitStrSize)
 {
-    static utf8 fitStr[32];
     utf8* fitStrEnd = fitStr;
-    safe_strcpy(fitStr, str, sizeof(fitStr));
+    safe_strcpy(fitStr, str, fitStrSize);
     int32_t w = 0;
     uint32_t codepoint;
     while (w <= text->max_width && (codepoint = utf8_get_next(fitStrEnd, (const utf8**)&fitStrEnd)) != 0)
@@ -115,7 +115,6 @@ static const utf8* large_scenery_sign_fit_text(const utf8* str, rct_large_scener
         }
     }
     *fitStrEnd = 0;
-    return fitStr;
 }
 
 static int32_t div_to_minus_infinity(int32_t a, int32_t b)
@@ -127,7 +126,9 @@ static void large_scenery_sign_paint_line(
     paint_session* session, const utf8* str, rct_large_scenery_text* text, int32_t textImage, int32_t textColour,
     uint8_t direction, int32_t y_offset)
 {
-    const utf8* fitStr = large_scenery_sign_fit_text(str, text, false);
+    utf8 fitStr[32];
+    large_scenery_sign_fit_text(str, text, false, fitStr, sizeof(fitStr));
+    const utf8* fitStrPtr = fitStr;
     int32_t width = large_scenery_sign_text_width(fitStr, text);
     int32_t x_offset = text->offset[(direction & 1)].x;
     int32_t acc = y_offset * ((direction & 1) ? -1 : 1);
@@ -138,7 +139,7 @@ static void large_scenery_sign_paint_line(
         acc -= (width / 2);
     }
     uint32_t codepoint;
-    while ((codepoint = utf8_get_next(fitStr, &fitStr)) != 0)
+    while ((codepoint = utf8_get_next(fitStrPtr, &fitStrPtr)) != 0)
     {
         int32_t glyph_offset = large_scenery_sign_get_glyph(text, codepoint)->image_offset;
         uint8_t glyph_type = direction & 1;
@@ -300,6 +301,7 @@ void large_scenery_paint(paint_session* session, uint8_t direction, uint16_t hei
         }
         // 6B8331:
         // Draw sign text:
+        std::lock_guard<std::mutex> lock(gPaintTextMutex);
         set_format_arg(0, uint32_t, 0);
         set_format_arg(4, uint32_t, 0);
         int32_t textColour = tileElement->AsLargeScenery()->GetSecondaryColour();
@@ -327,7 +329,7 @@ void large_scenery_paint(paint_session* session, uint8_t direction, uint16_t hei
             y_offset += 1;
             utf8 fitStr[32];
             const utf8* fitStrPtr = fitStr;
-            safe_strcpy(fitStr, large_scenery_sign_fit_text(signString, text, true), sizeof(fitStr));
+            large_scenery_sign_fit_text(signString, text, true, fitStr, sizeof(fitStr));
             int32_t height2 = large_scenery_sign_text_height(fitStr, text);
             uint32_t codepoint;
             while ((codepoint = utf8_get_next(fitStrPtr, &fitStrPtr)) != 0)
@@ -412,6 +414,7 @@ void large_scenery_paint(paint_session* session, uint8_t direction, uint16_t hei
         return;
     }
     // Draw scrolling text:
+    std::lock_guard<std::mutex> lock(gPaintTextMutex);
     set_format_arg(0, uint32_t, 0);
     set_format_arg(4, uint32_t, 0);
     uint8_t textColour = tileElement->AsLargeScenery()->GetSecondaryColour();
@@ -441,6 +441,7 @@ static void sub_6A4101(
             uint16_t scrollingMode = footpathEntry->scrolling_mode;
             scrollingMode += direction;
 
+            std::lock_guard<std::mutex> lock(gPaintTextMutex);
             set_format_arg(0, uint32_t, 0);
             set_format_arg(4, uint32_t, 0);
 
@@ -33,7 +33,7 @@
 #include <algorithm>
 
 #ifdef __TESTPAINT__
-uint16_t testPaintVerticalTunnelHeight;
+thread_local uint16_t testPaintVerticalTunnelHeight;
 #endif
 
 static void blank_tiles_paint(paint_session* session, int32_t x, int32_t y);
@@ -77,7 +77,7 @@ enum
 };
 
 #ifdef __TESTPAINT__
-extern uint16_t testPaintVerticalTunnelHeight;
+extern thread_local uint16_t testPaintVerticalTunnelHeight;
 #endif
 
 extern const int32_t SEGMENTS_ALL;
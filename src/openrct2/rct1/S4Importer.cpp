@@ -35,6 +35,7 @@
 #include "../peep/Peep.h"
 #include "../peep/Staff.h"
 #include "../ride/RideData.h"
+#include "../ride/RideProximity.h"
 #include "../ride/Station.h"
 #include "../ride/Track.h"
 #include "../scenario/Scenario.h"
@@ -164,17 +165,32 @@ public:
     }
 
     ParkLoadResult LoadFromStream(
-        IStream* stream, bool isScenario, [[maybe_unused]] bool skipObjectCheck, const utf8* path) override
+        IStream* stream, bool isScenario, bool skipObjectCheck, const utf8* path) override
     {
-        _s4 = *ReadAndDecodeS4(stream, isScenario);
+        ReadAndDecodeS4(stream, isScenario);
         _s4Path = path;
 
+        // The scenario index only reads the details, so it has no use for the objects
+        if (skipObjectCheck)
+        {
+            return ParkLoadResult({});
+        }
+
         // Only determine what objects we required to import this saved game
         InitialiseEntryMaps();
         CreateAvailableObjectMappings();
         return ParkLoadResult(GetRequiredObjects());
     }
 
+    void SetDeferPackedObjects([[maybe_unused]] bool defer) override
+    {
+        // RCT1 parks do not contain packed objects
+    }
+
+    void ExportPackedObjects() override
+    {
+    }
+
     void Import() override
     {
         Initialise();
@@ -286,32 +302,25 @@ public:
     }
 
 private:
-    std::unique_ptr<rct1_s4> ReadAndDecodeS4(IStream* stream, bool isScenario)
+    void ReadAndDecodeS4(IStream* stream, bool isScenario)
     {
-        auto s4 = std::make_unique<rct1_s4>();
         size_t dataSize = stream->GetLength() - stream->GetPosition();
         auto deleter_lambda = [dataSize](uint8_t* ptr) { Memory::FreeArray(ptr, dataSize); };
         auto data = std::unique_ptr<uint8_t, decltype(deleter_lambda)>(stream->ReadArray<uint8_t>(dataSize), deleter_lambda);
-        auto decodedData = std::unique_ptr<uint8_t, decltype(&Memory::Free<uint8_t>)>(
-            Memory::Allocate<uint8_t>(sizeof(rct1_s4)), &Memory::Free<uint8_t>);
 
+        // Decode straight into the park data rather than through intermediate copies of it
         size_t decodedSize;
         int32_t fileType = sawyercoding_detect_file_type(data.get(), dataSize);
         if (isScenario && (fileType & FILE_VERSION_MASK) != FILE_VERSION_RCT1)
         {
-            decodedSize = sawyercoding_decode_sc4(data.get(), decodedData.get(), dataSize, sizeof(rct1_s4));
+            decodedSize = sawyercoding_decode_sc4(data.get(), (uint8_t*)&_s4, dataSize, sizeof(rct1_s4));
         }
         else
         {
-            decodedSize = sawyercoding_decode_sv4(data.get(), decodedData.get(), dataSize, sizeof(rct1_s4));
+            decodedSize = sawyercoding_decode_sv4(data.get(), (uint8_t*)&_s4, dataSize, sizeof(rct1_s4));
         }
 
-        if (decodedSize == sizeof(rct1_s4))
-        {
-            std::memcpy(s4.get(), decodedData.get(), sizeof(rct1_s4));
-            return s4;
-        }
-        else
+        if (decodedSize != sizeof(rct1_s4))
         {
             throw std::runtime_error("Unable to decode park.");
         }
@@ -1965,6 +1974,8 @@ private:
         FixTerrain();
         FixEntrancePositions();
         FixTileElementEntryTypes();
+        ride_proximity_invalidate_all();
+        park_size_recount();
     }
 
     void ImportResearch()
@@ -2375,7 +2386,7 @@ private:
     void ClearExtraTileEntries()
     {
         // Reset the map tile pointers
-        std::fill(std::begin(gTileElementTilePointers), std::end(gTileElementTilePointers), nullptr);
+        std::fill_n(gTileElementTilePointers, MAX_TILE_TILE_ELEMENT_POINTERS, nullptr);
 
         // Get the first free map element
         TileElement* nextFreeTileElement = gTileElements;
@@ -62,6 +62,9 @@ private:
     rct_s6_data _s6{};
     uint8_t _gameVersion = 0;
 
+    bool _deferPackedObjects = false;
+    std::vector<std::pair<rct_object_entry, std::shared_ptr<SawyerChunk>>> _packedObjects;
+
 public:
     S6Importer(IObjectRepository& objectRepository)
         : _objectRepository(objectRepository)
@@ -139,7 +142,15 @@ public:
         // TODO try to contain this more and not store objects until later
         for (uint16_t i = 0; i < _s6.header.num_packed_objects; i++)
         {
-            _objectRepository.ExportPackedObject(stream);
+            if (_deferPackedObjects)
+            {
+                auto entry = stream->ReadValue<rct_object_entry>();
+                _packedObjects.emplace_back(entry, chunkReader.ReadChunk());
+            }
+            else
+            {
+                _objectRepository.ExportPackedObject(stream);
+            }
         }
 
         if (isScenario)
@@ -175,6 +186,24 @@ public:
         return false;
     }
 
+    void SetDeferPackedObjects(bool defer) override
+    {
+        _deferPackedObjects = defer;
+    }
+
+    void ExportPackedObjects() override
+    {
+        for (const auto& packedObject : _packedObjects)
+        {
+            if (_objectRepository.FindObject(&packedObject.first) == nullptr)
+            {
+                const auto& chunk = packedObject.second;
+                _objectRepository.AddObject(&packedObject.first, chunk->GetData(), chunk->GetLength());
+            }
+        }
+        _packedObjects.clear();
+    }
+
     void Import() override
     {
         Initialise();
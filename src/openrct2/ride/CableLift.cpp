@@ -15,6 +15,7 @@
 #include "Ride.h"
 #include "RideData.h"
 #include "Track.h"
+#include "TrackData.h"
 #include "VehicleData.h"
 
 #include <algorithm>
@@ -235,9 +236,8 @@ static bool sub_6DF01A_loop(rct_vehicle* vehicle)
 
         uint16_t trackProgress = vehicle->track_progress + 1;
 
-        const rct_vehicle_info* moveInfo = vehicle_get_move_info(vehicle->var_CD, vehicle->track_type, 0);
-        uint16_t trackTotalProgress = vehicle_get_move_info_size(vehicle->var_CD, vehicle->track_type);
-        if (trackProgress >= trackTotalProgress)
+        const rct_vehicle_info_list* moveInfoList = vehicle_get_move_info_list(vehicle->var_CD, vehicle->track_type);
+        if (trackProgress >= moveInfoList->size)
         {
             _vehicleVAngleEndF64E36 = TrackDefinitions[trackType].vangle_end;
             _vehicleBankEndF64E37 = TrackDefinitions[trackType].bank_end;
@@ -266,10 +266,11 @@ static bool sub_6DF01A_loop(rct_vehicle* vehicle)
             vehicle->track_direction = outputDirection;
             vehicle->track_type |= output.element->AsTrack()->GetTrackType() << 2;
             trackProgress = 0;
+            moveInfoList = vehicle_get_move_info_list(vehicle->var_CD, vehicle->track_type);
         }
 
         vehicle->track_progress = trackProgress;
-        moveInfo = vehicle_get_move_info(vehicle->var_CD, vehicle->track_type, trackProgress);
+        const rct_vehicle_info* moveInfo = vehicle_get_move_info(moveInfoList, trackProgress);
         LocationXYZ16 unk = { moveInfo->x, moveInfo->y, moveInfo->z };
 
         unk.x += vehicle->track_x;
@@ -308,7 +309,6 @@ static bool sub_6DF21B_loop(rct_vehicle* vehicle)
     for (; vehicle->remaining_distance < 0; _vehicleUnkF64E10++)
     {
         uint16_t trackProgress = vehicle->track_progress - 1;
-        const rct_vehicle_info* moveInfo;
 
         if ((int16_t)trackProgress == -1)
         {
@@ -344,13 +344,12 @@ static bool sub_6DF21B_loop(rct_vehicle* vehicle)
                 _vehicleMotionTrackFlags = VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_AT_STATION;
             }
 
-            moveInfo = vehicle_get_move_info(vehicle->var_CD, vehicle->track_type, 0);
-            uint16_t trackTotalProgress = vehicle_get_move_info_size(vehicle->var_CD, vehicle->track_type);
-            trackProgress = trackTotalProgress - 1;
+            trackProgress = vehicle_get_move_info_list(vehicle->var_CD, vehicle->track_type)->size - 1;
         }
         vehicle->track_progress = trackProgress;
 
-        moveInfo = vehicle_get_move_info(vehicle->var_CD, vehicle->track_type, trackProgress);
+        const rct_vehicle_info_list* moveInfoList = vehicle_get_move_info_list(vehicle->var_CD, vehicle->track_type);
+        const rct_vehicle_info* moveInfo = vehicle_get_move_info(moveInfoList, trackProgress);
         LocationXYZ16 unk = { moveInfo->x, moveInfo->y, moveInfo->z };
 
         unk.x += vehicle->track_x;
@@ -0,0 +1,161 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2018 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "RideProximity.h"
+
+#include "../world/Map.h"
+#include "Track.h"
+
+#include <algorithm>
+
+// Blocks of 4x4 tiles
+constexpr int32_t RIDE_PROXIMITY_BLOCK_SHIFT = 2;
+constexpr int32_t RIDE_PROXIMITY_BLOCK_SIZE = 1 << RIDE_PROXIMITY_BLOCK_SHIFT;
+constexpr int32_t RIDE_PROXIMITY_BLOCKS_PER_ROW = MAXIMUM_MAP_SIZE_TECHNICAL >> RIDE_PROXIMITY_BLOCK_SHIFT;
+
+struct ride_proximity_block
+{
+    // Rides that have track in the block
+    uint32_t rides[8];
+    // Tiles of the block that have track, one bit per tile in row order
+    uint16_t track_tiles;
+    // Blocks are rebuilt when they are dirty or were built before the index was last discarded
+    bool dirty;
+    uint32_t generation;
+};
+
+static ride_proximity_block _rideProximityBlocks[RIDE_PROXIMITY_BLOCKS_PER_ROW * RIDE_PROXIMITY_BLOCKS_PER_ROW];
+// Starts at 1 so that the zero initialised blocks are out of date
+static uint32_t _rideProximityGeneration = 1;
+
+void ride_proximity_invalidate_tile(int32_t tileX, int32_t tileY)
+{
+    if (tileX < 0 || tileY < 0 || tileX >= MAXIMUM_MAP_SIZE_TECHNICAL || tileY >= MAXIMUM_MAP_SIZE_TECHNICAL)
+    {
+        return;
+    }
+
+    int32_t blockX = tileX >> RIDE_PROXIMITY_BLOCK_SHIFT;
+    int32_t blockY = tileY >> RIDE_PROXIMITY_BLOCK_SHIFT;
+    _rideProximityBlocks[blockY * RIDE_PROXIMITY_BLOCKS_PER_ROW + blockX].dirty = true;
+}
+
+void ride_proximity_invalidate_all()
+{
+    _rideProximityGeneration++;
+}
+
+/**
+ * Adds the rides that have track on the tile to rides, returns whether the tile has any track.
+ */
+static bool ride_proximity_scan_tile(int32_t tileX, int32_t tileY, uint32_t rides[8], const uint32_t* candidates)
+{
+    bool hasTrack = false;
+    TileElement* tileElement = map_get_first_element_at(tileX, tileY);
+    do
+    {
+        if (tileElement->GetType() != TILE_ELEMENT_TYPE_TRACK)
+            continue;
+
+        int32_t rideIndex = tileElement->AsTrack()->GetRideIndex();
+        uint32_t bit = 1u << (rideIndex & 0x1F);
+        if (candidates == nullptr || (candidates[rideIndex >> 5] & bit))
+        {
+            rides[rideIndex >> 5] |= bit;
+        }
+        hasTrack = true;
+    } while (!(tileElement++)->IsLastForTile());
+    return hasTrack;
+}
+
+static const ride_proximity_block& ride_proximity_get_block(int32_t blockX, int32_t blockY)
+{
+    auto& block = _rideProximityBlocks[blockY * RIDE_PROXIMITY_BLOCKS_PER_ROW + blockX];
+    if (block.dirty || block.generation != _rideProximityGeneration)
+    {
+        std::fill(std::begin(block.rides), std::end(block.rides), 0);
+        block.track_tiles = 0;
+        for (int32_t i = 0; i < RIDE_PROXIMITY_BLOCK_SIZE * RIDE_PROXIMITY_BLOCK_SIZE; i++)
+        {
+            int32_t tileX = (blockX << RIDE_PROXIMITY_BLOCK_SHIFT) + (i % RIDE_PROXIMITY_BLOCK_SIZE);
+            int32_t tileY = (blockY << RIDE_PROXIMITY_BLOCK_SHIFT) + (i / RIDE_PROXIMITY_BLOCK_SIZE);
+            if (ride_proximity_scan_tile(tileX, tileY, block.rides, nullptr))
+            {
+                block.track_tiles |= 1 << i;
+            }
+        }
+        block.dirty = false;
+        block.generation = _rideProximityGeneration;
+    }
+    return block;
+}
+
+void ride_proximity_get_nearby_rides(
+    int32_t tileX, int32_t tileY, int32_t range, uint32_t rides[8], const uint32_t* candidates)
+{
+    int32_t left = std::max(0, tileX - range);
+    int32_t top = std::max(0, tileY - range);
+    int32_t right = std::min(MAXIMUM_MAP_SIZE_TECHNICAL - 1, tileX + range);
+    int32_t bottom = std::min(MAXIMUM_MAP_SIZE_TECHNICAL - 1, tileY + range);
+    if (left > right || top > bottom)
+    {
+        return;
+    }
+
+    for (int32_t blockY = top >> RIDE_PROXIMITY_BLOCK_SHIFT; blockY <= bottom >> RIDE_PROXIMITY_BLOCK_SHIFT; blockY++)
+    {
+        for (int32_t blockX = left >> RIDE_PROXIMITY_BLOCK_SHIFT; blockX <= right >> RIDE_PROXIMITY_BLOCK_SHIFT; blockX++)
+        {
+            const auto& block = ride_proximity_get_block(blockX, blockY);
+
+            // Skip blocks that can not add any ride that has not been found yet
+            bool hasNewRides = false;
+            for (int32_t i = 0; i < 8; i++)
+            {
+                uint32_t newRides = block.rides[i] & ~rides[i];
+                if (candidates != nullptr)
+                {
+                    newRides &= candidates[i];
+                }
+                hasNewRides |= newRides != 0;
+            }
+            if (!hasNewRides)
+            {
+                continue;
+            }
+
+            int32_t blockLeft = blockX << RIDE_PROXIMITY_BLOCK_SHIFT;
+            int32_t blockTop = blockY << RIDE_PROXIMITY_BLOCK_SHIFT;
+            int32_t blockRight = blockLeft + RIDE_PROXIMITY_BLOCK_SIZE - 1;
+            int32_t blockBottom = blockTop + RIDE_PROXIMITY_BLOCK_SIZE - 1;
+            if (blockLeft >= left && blockTop >= top && blockRight <= right && blockBottom <= bottom)
+            {
+                for (int32_t i = 0; i < 8; i++)
+                {
+                    rides[i] |= candidates != nullptr ? (block.rides[i] & candidates[i]) : block.rides[i];
+                }
+                continue;
+            }
+
+            // Only part of the block is in range, so look at the tiles with track that are
+            for (int32_t i = 0; i < RIDE_PROXIMITY_BLOCK_SIZE * RIDE_PROXIMITY_BLOCK_SIZE; i++)
+            {
+                if (!(block.track_tiles & (1 << i)))
+                    continue;
+
+                int32_t x = blockLeft + (i % RIDE_PROXIMITY_BLOCK_SIZE);
+                int32_t y = blockTop + (i / RIDE_PROXIMITY_BLOCK_SIZE);
+                if (x >= left && x <= right && y >= top && y <= bottom)
+                {
+                    ride_proximity_scan_tile(x, y, rides, candidates);
+                }
+            }
+        }
+    }
+}
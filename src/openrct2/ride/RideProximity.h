@@ -0,0 +1,29 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2018 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../common.h"
+
+/**
+ * Marks the tile as possibly having gained track, e.g. after an element has been inserted on it.
+ */
+void ride_proximity_invalidate_tile(int32_t tileX, int32_t tileY);
+
+/**
+ * Discards the whole index, required when track has been removed or the tile elements have been replaced.
+ */
+void ride_proximity_invalidate_all();
+
+/**
+ * Adds the rides that have track on any tile within range tiles of the given tile to the rides bit set. Only rides that
+ * are also in the candidates bit set are added, unless candidates is nullptr.
+ */
+void ride_proximity_get_nearby_rides(
+    int32_t tileX, int32_t tileY, int32_t range, uint32_t rides[8], const uint32_t* candidates = nullptr);
@@ -36,16 +36,25 @@
 #include "../world/Wall.h"
 #include "Ride.h"
 #include "RideData.h"
+#include "RideProximity.h"
 #include "Track.h"
 #include "TrackData.h"
 #include "TrackDesignRepository.h"
 
 #include <algorithm>
 
-struct map_backup
+// The map the track design preview is placed on, swapped in for the park's map so that the latter is left untouched
+struct preview_map
 {
-    TileElement tile_elements[MAX_TILE_ELEMENTS];
+    TileElement tile_elements[MAX_TILE_TILE_ELEMENT_POINTERS * 3];
     TileElement* tile_pointers[MAX_TILE_TILE_ELEMENT_POINTERS];
+};
+
+struct map_backup
+{
+    preview_map* preview;
+    TileElement* tile_elements;
+    TileElement** tile_pointers;
     TileElement* next_free_tile_element;
     uint16_t map_size_units;
     uint16_t map_size_units_minus_2;
@@ -74,6 +83,8 @@ static bool _trackDesignPlaceStatePlaceScenery = true;
 
 static rct_track_td6* track_design_open_from_buffer(uint8_t* src, size_t srcLength);
 
+static rct_object_entry td4_get_vehicle_object(uint8_t type, uint8_t vehicleType);
+
 static map_backup* track_design_preview_backup_map();
 
 static void track_design_preview_restore_map(map_backup* backup);
@@ -124,6 +135,81 @@ rct_track_td6* track_design_open(const utf8* path)
     return nullptr;
 }
 
+/**
+ * Reads only the ride type and vehicle object of a track design, decoding just the start of the file where they are
+ * stored rather than the whole design.
+ */
+bool track_design_read_ride_info(const utf8* path, uint8_t* outRideType, rct_object_entry* outVehicleObject)
+{
+    log_verbose("track_design_read_ride_info(\"%s\")", path);
+
+    try
+    {
+        auto buffer = File::ReadAllBytes(path);
+        if (!sawyercoding_validate_track_checksum(buffer.data(), buffer.size()))
+        {
+            log_error("Track checksum failed. %s", path);
+            return false;
+        }
+
+        // Large enough for the header of every track design version
+        uint8_t header[0xC4];
+        size_t headerLength = sawyercoding_decode_td6_header(buffer.data(), header, buffer.size(), sizeof(header));
+        if (headerLength < 8)
+        {
+            log_error("Unsupported track design.");
+            return false;
+        }
+
+        uint8_t version = (header[7] >> 2) & 3;
+        if (version == 0 || version == 1)
+        {
+            size_t td4HeaderLength = version == 0 ? 0x38 : 0xC4;
+            if (headerLength < td4HeaderLength)
+            {
+                log_error("Unsupported track design.");
+                return false;
+            }
+            auto td4 = (const rct_track_td4*)header;
+            *outRideType = RCT1::GetRideType(td4->type);
+            *outVehicleObject = td4_get_vehicle_object(td4->type, td4->vehicle_type);
+            return true;
+        }
+        else if (version == 2 && headerLength >= 0xA3)
+        {
+            auto td6 = (const rct_track_td6*)header;
+            *outRideType = td6->type;
+            *outVehicleObject = td6->vehicle_object;
+            return true;
+        }
+        log_error("Unsupported track design.");
+    }
+    catch (const std::exception& e)
+    {
+        log_error("Unable to load track design: %s", e.what());
+    }
+    return false;
+}
+
+static rct_object_entry td4_get_vehicle_object(uint8_t type, uint8_t vehicleType)
+{
+    // Convert RCT1 vehicle type to RCT2 vehicle type. Intialise with an string consisting of 8 spaces.
+    rct_object_entry vehicleObject = { 0x80, "        " };
+    if (type == RIDE_TYPE_MAZE)
+    {
+        const char* name = RCT1::GetRideTypeObject(type);
+        assert(name != nullptr);
+        memcpy(vehicleObject.name, name, std::min(String::SizeOf(name), (size_t)8));
+    }
+    else
+    {
+        const char* name = RCT1::GetVehicleObject(vehicleType);
+        assert(name != nullptr);
+        memcpy(vehicleObject.name, name, std::min(String::SizeOf(name), (size_t)8));
+    }
+    return vehicleObject;
+}
+
 static rct_track_td6* track_design_open_from_td4(uint8_t* src, size_t srcLength)
 {
     rct_track_td4* td4 = (rct_track_td4*)calloc(1, sizeof(rct_track_td4));
@@ -185,20 +271,7 @@ static rct_track_td6* track_design_open_from_td4(uint8_t* src, size_t srcLength)
         td6->ride_mode = RIDE_MODE_POWERED_LAUNCH;
     }
 
-    // Convert RCT1 vehicle type to RCT2 vehicle type. Intialise with an string consisting of 8 spaces.
-    rct_object_entry vehicleObject = { 0x80, "        " };
-    if (td4->type == RIDE_TYPE_MAZE)
-    {
-        const char* name = RCT1::GetRideTypeObject(td4->type);
-        assert(name != nullptr);
-        memcpy(vehicleObject.name, name, std::min(String::SizeOf(name), (size_t)8));
-    }
-    else
-    {
-        const char* name = RCT1::GetVehicleObject(td4->vehicle_type);
-        assert(name != nullptr);
-        memcpy(vehicleObject.name, name, std::min(String::SizeOf(name), (size_t)8));
-    }
+    rct_object_entry vehicleObject = td4_get_vehicle_object(td4->type, td4->vehicle_type);
     memcpy(&td6->vehicle_object, &vehicleObject, sizeof(rct_object_entry));
     td6->vehicle_type = td4->vehicle_type;
 
@@ -2281,8 +2354,7 @@ void track_design_draw_preview(rct_track_td6* td6, uint8_t* pixels)
 }
 
 /**
- * Create a backup of the map as it will be cleared for drawing the track
- * design preview.
+ * Swaps in an empty map for drawing the track design preview, keeping what is needed to switch back to the park's map.
  *  rct2: 0x006D1C68
  */
 static map_backup* track_design_preview_backup_map()
@@ -2290,13 +2362,23 @@ static map_backup* track_design_preview_backup_map()
     map_backup* backup = (map_backup*)malloc(sizeof(map_backup));
     if (backup != nullptr)
     {
-        memcpy(backup->tile_elements, gTileElements, sizeof(backup->tile_elements));
-        memcpy(backup->tile_pointers, gTileElementTilePointers, sizeof(backup->tile_pointers));
+        // Left uninitialised, only the part that track_design_preview_clear_map sets up is ever used
+        backup->preview = (preview_map*)malloc(sizeof(preview_map));
+        if (backup->preview == nullptr)
+        {
+            free(backup);
+            return nullptr;
+        }
+        backup->tile_elements = gTileElements;
+        backup->tile_pointers = gTileElementTilePointers;
         backup->next_free_tile_element = gNextFreeTileElement;
         backup->map_size_units = gMapSizeUnits;
         backup->map_size_units_minus_2 = gMapSizeMinus2;
         backup->map_size = gMapSize;
         backup->current_rotation = get_current_rotation();
+
+        gTileElements = backup->preview->tile_elements;
+        gTileElementTilePointers = backup->preview->tile_pointers;
     }
     return backup;
 }
@@ -2307,14 +2389,19 @@ static map_backup* track_design_preview_backup_map()
  */
 static void track_design_preview_restore_map(map_backup* backup)
 {
-    memcpy(gTileElements, backup->tile_elements, sizeof(backup->tile_elements));
-    memcpy(gTileElementTilePointers, backup->tile_pointers, sizeof(backup->tile_pointers));
+    gTileElements = backup->tile_elements;
+    gTileElementTilePointers = backup->tile_pointers;
     gNextFreeTileElement = backup->next_free_tile_element;
     gMapSizeUnits = backup->map_size_units;
     gMapSizeMinus2 = backup->map_size_units_minus_2;
     gMapSize = backup->map_size;
     gCurrentRotation = backup->current_rotation;
 
+    // The map indexes were rebuilt for the preview map when it was cleared
+    ride_proximity_invalidate_all();
+    park_size_recount();
+
+    free(backup->preview);
     free(backup);
 }
 
@@ -223,6 +223,7 @@ extern bool gTrackDesignSaveMode;
 extern uint8_t gTrackDesignSaveRideIndex;
 
 rct_track_td6* track_design_open(const utf8* path);
+bool track_design_read_ride_info(const utf8* path, uint8_t* outRideType, rct_object_entry* outVehicleObject);
 void track_design_dispose(rct_track_td6* td6);
 
 void track_design_mirror(rct_track_td6* td6);
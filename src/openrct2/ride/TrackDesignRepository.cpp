@@ -75,20 +75,21 @@ public:
 public:
     std::tuple<bool, TrackRepositoryItem> Create(int32_t, const std::string& path) const override
     {
-        auto td6 = track_design_open(path.c_str());
-        if (td6 != nullptr)
+        // The index only needs the ride, so skip decoding the track elements
+        uint8_t rideType;
+        rct_object_entry vehicleObject;
+        if (track_design_read_ride_info(path.c_str(), &rideType, &vehicleObject))
         {
             TrackRepositoryItem item;
             item.Name = GetNameFromTrackPath(path);
             item.Path = path;
-            item.RideType = td6->type;
-            item.ObjectEntry = std::string(td6->vehicle_object.name, 8);
+            item.RideType = rideType;
+            item.ObjectEntry = std::string(vehicleObject.name, 8);
             item.Flags = 0;
             if (IsTrackReadOnly(path))
             {
                 item.Flags |= TRIF_READ_ONLY;
             }
-            track_design_dispose(td6);
             return std::make_tuple(true, item);
         }
         else
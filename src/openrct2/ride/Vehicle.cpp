@@ -760,73 +760,81 @@ static const struct
 
 // clang-format on
 
-static bool vehicle_move_info_valid(int32_t cd, int32_t typeAndDirection, int32_t offset)
+// Number of track type and direction entries in each of the gTrackVehicleInfo lists
+static constexpr uint16_t MoveInfoListCounts[] = {
+    1024, 692, 404, 404, 404, 208, 208, 208, 208, 824, 824, 824, 824, 824, 824, 868, 868,
+};
+static_assert(Util::CountOf(MoveInfoListCounts) == Util::CountOf(gTrackVehicleInfo));
+
+static constexpr size_t GetMoveInfoListTotal()
 {
-    if (cd >= static_cast<int32_t>(Util::CountOf(gTrackVehicleInfo)))
+    size_t total = 0;
+    for (auto count : MoveInfoListCounts)
     {
-        return false;
+        total += count;
     }
-    int32_t size = 0;
-    switch (cd)
-    {
-        case 0:
-            size = 1024;
-            break;
-        case 1:
-            size = 692;
-            break;
-        case 2:
-        case 3:
-        case 4:
-            size = 404;
-            break;
-        case 5:
-        case 6:
-        case 7:
-        case 8:
-            size = 208;
-            break;
-        case 9:
-        case 10:
-        case 11:
-        case 12:
-        case 13:
-        case 14:
-            size = 824;
-            break;
-        case 15:
-        case 16:
-            size = 868;
-            break;
-    }
-    if (typeAndDirection >= size)
+    return total;
+}
+
+/**
+ * gTrackVehicleInfo flattened into one contiguous array. Looking up the move info of a track piece is then
+ * a bounds check and a single load rather than a switch and two dependent pointer reads.
+ */
+class VehicleMoveInfoTable
+{
+private:
+    alignas(64) rct_vehicle_info_list _lists[GetMoveInfoListTotal()];
+    uint16_t _offsets[Util::CountOf(MoveInfoListCounts)];
+
+public:
+    VehicleMoveInfoTable()
     {
-        return false;
+        size_t index = 0;
+        for (size_t cd = 0; cd < Util::CountOf(MoveInfoListCounts); cd++)
+        {
+            _offsets[cd] = (uint16_t)index;
+            for (size_t typeAndDirection = 0; typeAndDirection < MoveInfoListCounts[cd]; typeAndDirection++)
+            {
+                _lists[index++] = *gTrackVehicleInfo[cd][typeAndDirection];
+            }
+        }
     }
-    if (offset >= gTrackVehicleInfo[cd][typeAndDirection]->size)
+
+    const rct_vehicle_info_list* Get(int32_t cd, int32_t typeAndDirection) const
     {
-        return false;
+        static constexpr const rct_vehicle_info_list empty = {};
+        if ((uint32_t)cd >= Util::CountOf(MoveInfoListCounts) || (uint32_t)typeAndDirection >= MoveInfoListCounts[cd])
+        {
+            return &empty;
+        }
+        return &_lists[_offsets[cd] + typeAndDirection];
     }
-    return true;
+};
+
+const rct_vehicle_info_list* vehicle_get_move_info_list(int32_t cd, int32_t typeAndDirection)
+{
+    static const VehicleMoveInfoTable table;
+    return table.Get(cd, typeAndDirection);
 }
 
-const rct_vehicle_info* vehicle_get_move_info(int32_t cd, int32_t typeAndDirection, int32_t offset)
+const rct_vehicle_info* vehicle_get_move_info(const rct_vehicle_info_list* list, int32_t offset)
 {
-    if (!vehicle_move_info_valid(cd, typeAndDirection, offset))
+    if ((uint32_t)offset >= list->size)
     {
         static constexpr const rct_vehicle_info zero = {};
         return &zero;
     }
-    return &gTrackVehicleInfo[cd][typeAndDirection]->info[offset];
+    return &list->info[offset];
+}
+
+const rct_vehicle_info* vehicle_get_move_info(int32_t cd, int32_t typeAndDirection, int32_t offset)
+{
+    return vehicle_get_move_info(vehicle_get_move_info_list(cd, typeAndDirection), offset);
 }
 
 uint16_t vehicle_get_move_info_size(int32_t cd, int32_t typeAndDirection)
 {
-    if (!vehicle_move_info_valid(cd, typeAndDirection, 0))
-    {
-        return 0;
-    }
-    return gTrackVehicleInfo[cd][typeAndDirection]->size;
+    return vehicle_get_move_info_list(cd, typeAndDirection)->size;
 }
 
 rct_vehicle* try_get_vehicle(uint16_t spriteIndex)
@@ -6468,18 +6476,15 @@ bool vehicle_update_dodgems_collision(rct_vehicle* vehicle, int16_t x, int16_t y
         location.x += xy_offset.x;
         location.y += xy_offset.y;
 
-        uint16_t spriteIdx = sprite_get_first_in_quadrant(location.x * 32, location.y * 32);
+        uint16_t spriteIdx = sprite_get_first_vehicle_in_quadrant(location.x * 32, location.y * 32);
         while (spriteIdx != SPRITE_INDEX_NULL)
         {
             rct_vehicle* vehicle2 = GET_VEHICLE(spriteIdx);
-            spriteIdx = vehicle2->next_in_quadrant;
+            spriteIdx = sprite_get_next_vehicle_in_quadrant(spriteIdx);
 
             if (vehicle2 == vehicle)
                 continue;
 
-            if (vehicle2->sprite_identifier != SPRITE_IDENTIFIER_VEHICLE)
-                continue;
-
             if (vehicle2->ride != rideIndex)
                 continue;
 
@@ -7700,16 +7705,13 @@ static bool vehicle_update_motion_collision_detection(
         location.x += xy_offset.x;
         location.y += xy_offset.y;
 
-        collideId = sprite_get_first_in_quadrant(location.x * 32, location.y * 32);
-        for (; collideId != SPRITE_INDEX_NULL; collideId = collideVehicle->next_in_quadrant)
+        collideId = sprite_get_first_vehicle_in_quadrant(location.x * 32, location.y * 32);
+        for (; collideId != SPRITE_INDEX_NULL; collideId = sprite_get_next_vehicle_in_quadrant(collideId))
         {
             collideVehicle = GET_VEHICLE(collideId);
             if (collideVehicle == vehicle)
                 continue;
 
-            if (collideVehicle->sprite_identifier != SPRITE_IDENTIFIER_VEHICLE)
-                continue;
-
             int32_t z_diff = abs(collideVehicle->z - z);
 
             if (z_diff > 16)
@@ -8244,11 +8246,9 @@ loc_6DAEB9:
 
     regs.ax = vehicle->track_progress + 1;
 
-    const rct_vehicle_info* moveInfo = vehicle_get_move_info(vehicle->var_CD, vehicle->track_type, 0);
-
     // Track Total Progress is in the two bytes before the move info list
-    uint16_t trackTotalProgress = vehicle_get_move_info_size(vehicle->var_CD, vehicle->track_type);
-    if (regs.ax >= trackTotalProgress)
+    const rct_vehicle_info_list* moveInfoList = vehicle_get_move_info_list(vehicle->var_CD, vehicle->track_type);
+    if (regs.ax >= moveInfoList->size)
     {
         vehicle_update_crossings(vehicle);
 
@@ -8257,15 +8257,16 @@ loc_6DAEB9:
             goto loc_6DB94A;
         }
         regs.ax = 0;
+        moveInfoList = vehicle_get_move_info_list(vehicle->var_CD, vehicle->track_type);
     }
 
     vehicle->track_progress = regs.ax;
     vehicle_update_handle_water_splash(vehicle);
 
     // loc_6DB706
-    moveInfo = vehicle_get_move_info(vehicle->var_CD, vehicle->track_type, vehicle->track_progress);
     trackType = vehicle->track_type >> 2;
     {
+        const rct_vehicle_info* moveInfo = vehicle_get_move_info(moveInfoList, vehicle->track_progress);
         int16_t x = vehicle->track_x + moveInfo->x;
         int16_t y = vehicle->track_y + moveInfo->y;
         int16_t z = vehicle->track_z + moveInfo->z + RideData5[ride->type].z_offset;
@@ -8548,9 +8549,7 @@ static bool vehicle_update_track_motion_backwards_get_new_track(
     vehicle->track_direction |= direction;
     vehicle->brake_speed = tileElement->AsTrack()->GetBrakeBoosterSpeed();
 
-    // There are two bytes before the move info list
-    uint16_t trackTotalProgress = vehicle_get_move_info_size(vehicle->var_CD, vehicle->track_type);
-    *progress = trackTotalProgress - 1;
+    *progress = vehicle_get_move_info_list(vehicle->var_CD, vehicle->track_type)->size - 1;
     return true;
 }
 
@@ -8610,7 +8609,8 @@ loc_6DBA33:;
     // loc_6DBD42
     vehicle->track_progress = regs.ax;
     {
-        const rct_vehicle_info* moveInfo = vehicle_get_move_info(vehicle->var_CD, vehicle->track_type, vehicle->track_progress);
+        const rct_vehicle_info_list* moveInfoList = vehicle_get_move_info_list(vehicle->var_CD, vehicle->track_type);
+        const rct_vehicle_info* moveInfo = vehicle_get_move_info(moveInfoList, vehicle->track_progress);
         int16_t x = vehicle->track_x + moveInfo->x;
         int16_t y = vehicle->track_y + moveInfo->y;
         int16_t z = vehicle->track_z + moveInfo->z + RideData5[ride->type].z_offset;
@@ -17,6 +17,8 @@
 #include <cstddef>
 #include <vector>
 
+struct rct_vehicle_info_list;
+
 struct rct_vehicle_colour
 {
     uint8_t body_colour;
@@ -472,6 +474,8 @@ void vehicle_test_reset(rct_vehicle* vehicle);
 void vehicle_peep_easteregg_here_we_are(const rct_vehicle* vehicle);
 rct_vehicle* vehicle_get_head(const rct_vehicle* vehicle);
 rct_vehicle* vehicle_get_tail(const rct_vehicle* vehicle);
+const rct_vehicle_info_list* vehicle_get_move_info_list(int32_t cd, int32_t typeAndDirection);
+const rct_vehicle_info* vehicle_get_move_info(const rct_vehicle_info_list* list, int32_t offset);
 const rct_vehicle_info* vehicle_get_move_info(int32_t cd, int32_t typeAndDirection, int32_t offset);
 uint16_t vehicle_get_move_info_size(int32_t cd, int32_t typeAndDirection);
 bool vehicle_update_dodgems_collision(rct_vehicle* vehicle, int16_t x, int16_t y, uint16_t* spriteId);
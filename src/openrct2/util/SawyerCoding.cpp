@@ -18,6 +18,7 @@
 
 static size_t decode_chunk_rle(const uint8_t* src_buffer, uint8_t* dst_buffer, size_t length);
 static size_t decode_chunk_rle_with_size(const uint8_t* src_buffer, uint8_t* dst_buffer, size_t length, size_t dstSize);
+static size_t decode_chunk_rle_prefix(const uint8_t* src_buffer, uint8_t* dst_buffer, size_t length, size_t dstSize);
 
 static size_t encode_chunk_rle(const uint8_t* src_buffer, uint8_t* dst_buffer, size_t length);
 static size_t encode_chunk_repeat(const uint8_t* src_buffer, uint8_t* dst_buffer, size_t length);
@@ -143,6 +144,11 @@ size_t sawyercoding_decode_td6(const uint8_t* src, uint8_t* dst, size_t length)
     return decode_chunk_rle(src, dst, length - 4);
 }
 
+size_t sawyercoding_decode_td6_header(const uint8_t* src, uint8_t* dst, size_t length, size_t headerLength)
+{
+    return decode_chunk_rle_prefix(src, dst, length - 4, headerLength);
+}
+
 size_t sawyercoding_encode_td6(const uint8_t* src, uint8_t* dst, size_t length)
 {
     size_t output_length = encode_chunk_rle(src, dst, length);
@@ -258,6 +264,35 @@ static size_t decode_chunk_rle_with_size(const uint8_t* src_buffer, uint8_t* dst
     return dst - dst_buffer;
 }
 
+/**
+ * Decodes no more than dstSize bytes, stopping once they have been decoded.
+ */
+static size_t decode_chunk_rle_prefix(const uint8_t* src_buffer, uint8_t* dst_buffer, size_t length, size_t dstSize)
+{
+    size_t dstLength = 0;
+    for (size_t i = 0; i < length && dstLength < dstSize; i++)
+    {
+        uint8_t rleCodeByte = src_buffer[i];
+        if (rleCodeByte & 128)
+        {
+            i++;
+            if (i >= length)
+                break;
+            size_t count = std::min<size_t>(257 - rleCodeByte, dstSize - dstLength);
+            memset(dst_buffer + dstLength, src_buffer[i], count);
+            dstLength += count;
+        }
+        else
+        {
+            size_t count = std::min<size_t>({ (size_t)rleCodeByte + 1, dstSize - dstLength, length - i - 1 });
+            memcpy(dst_buffer + dstLength, src_buffer + i + 1, count);
+            dstLength += count;
+            i += rleCodeByte + 1;
+        }
+    }
+    return dstLength;
+}
+
 #pragma endregion
 
 #pragma region Encoding
@@ -50,6 +50,7 @@ size_t sawyercoding_decode_sv4(const uint8_t* src, uint8_t* dst, size_t length,
 size_t sawyercoding_decode_sc4(const uint8_t* src, uint8_t* dst, size_t length, size_t bufferLength);
 size_t sawyercoding_encode_sv4(const uint8_t* src, uint8_t* dst, size_t length);
 size_t sawyercoding_decode_td6(const uint8_t* src, uint8_t* dst, size_t length);
+size_t sawyercoding_decode_td6_header(const uint8_t* src, uint8_t* dst, size_t length, size_t headerLength);
 size_t sawyercoding_encode_td6(const uint8_t* src, uint8_t* dst, size_t length);
 int32_t sawyercoding_validate_track_checksum(const uint8_t* src, size_t length);
 
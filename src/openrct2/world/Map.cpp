@@ -27,6 +27,7 @@
 #include "../management/Finance.h"
 #include "../network/network.h"
 #include "../ride/RideData.h"
+#include "../ride/RideProximity.h"
 #include "../ride/Track.h"
 #include "../ride/TrackData.h"
 #include "../ride/TrackDesign.h"
@@ -93,8 +94,10 @@ int16_t gMapSize;
 int16_t gMapSizeMaxXY;
 int16_t gMapBaseZ;
 
-TileElement gTileElements[MAX_TILE_TILE_ELEMENT_POINTERS * 3];
-TileElement* gTileElementTilePointers[MAX_TILE_TILE_ELEMENT_POINTERS];
+static TileElement _tileElements[MAX_TILE_TILE_ELEMENT_POINTERS * 3];
+static TileElement* _tileElementTilePointers[MAX_TILE_TILE_ELEMENT_POINTERS];
+TileElement* gTileElements = _tileElements;
+TileElement** gTileElementTilePointers = _tileElementTilePointers;
 LocationXY16 gMapSelectionTiles[300];
 PeepSpawn gPeepSpawns[MAX_PEEP_SPAWNS];
 
@@ -422,9 +425,9 @@ void map_count_remaining_land_rights()
  */
 void map_strip_ghost_flag_from_elements()
 {
-    for (auto& element : gTileElements)
+    for (int32_t i = 0; i < MAX_TILE_ELEMENTS; i++)
     {
-        element.flags &= ~TILE_ELEMENT_FLAG_GHOST;
+        gTileElements[i].flags &= ~TILE_ELEMENT_FLAG_GHOST;
     }
 }
 
@@ -454,6 +457,8 @@ void map_update_tile_pointers()
     }
 
     gNextFreeTileElement = tileElement;
+    ride_proximity_invalidate_all();
+    park_size_recount();
 }
 
 /**
@@ -3101,6 +3106,15 @@ void game_command_place_large_scenery(
  */
 void tile_element_remove(TileElement* tileElement)
 {
+    if (tileElement->GetType() == TILE_ELEMENT_TYPE_TRACK)
+    {
+        ride_proximity_invalidate_all();
+    }
+    else if (tileElement->GetType() == TILE_ELEMENT_TYPE_SURFACE)
+    {
+        park_size_ownership_changed(tileElement->AsSurface()->GetOwnership(), OWNERSHIP_UNOWNED);
+    }
+
     // Replace Nth element by (N+1)th element.
     // This loop will make tileElement point to the old last element position,
     // after copy it to it's new position
@@ -3389,6 +3403,7 @@ TileElement* tile_element_insert(int32_t x, int32_t y, int32_t z, int32_t flags)
     }
 
     gNextFreeTileElement = newTileElement;
+    ride_proximity_invalidate_tile(x, y);
     return insertedElement;
 }
 
@@ -102,8 +102,9 @@ extern uint8_t gMapSelectArrowDirection;
 
 extern uint8_t gMapGroundFlags;
 
-extern TileElement gTileElements[MAX_TILE_TILE_ELEMENT_POINTERS * 3];
-extern TileElement* gTileElementTilePointers[MAX_TILE_TILE_ELEMENT_POINTERS];
+// Point at the park's map, unless a temporary map such as the track design preview has been swapped in
+extern TileElement* gTileElements;
+extern TileElement** gTileElementTilePointers;
 
 extern LocationXY16 gMapSelectionTiles[300];
 extern PeepSpawn gPeepSpawns[MAX_PEEP_SPAWNS];
@@ -65,6 +65,9 @@ uint8_t gGuestsInParkHistory[32];
 // If this value is more than or equal to 0, the park rating is forced to this value. Used for cheat
 static int32_t _forcedParkRating = -1;
 
+// Number of surface elements with owned land or construction rights, kept up to date as the ownership changes
+static int32_t _parkOwnedTileCount;
+
 /**
  * In a difficult guest generation scenario, no guests will be generated if over this value.
  */
@@ -613,12 +616,8 @@ void Park::Update(const Date& date)
         auto intent = Intent(INTENT_ACTION_UPDATE_PARK_RATING);
         context_broadcast_intent(&intent);
     }
-    // Every ~102 seconds
-    if (gCurrentTicks % 4096 == 0)
-    {
-        gParkSize = CalculateParkSize();
-        window_invalidate_by_class(WC_PARK_INFORMATION);
-    }
+    // The owned tiles are counted as the ownership changes, this only publishes the count
+    CalculateParkSize();
     // Every new week
     if (date.IsWeekStart())
     {
@@ -629,22 +628,7 @@ void Park::Update(const Date& date)
 
 int32_t Park::CalculateParkSize() const
 {
-    int32_t tiles;
-    tile_element_iterator it;
-
-    tiles = 0;
-    tile_element_iterator_begin(&it);
-    do
-    {
-        if (it.element->GetType() == TILE_ELEMENT_TYPE_SURFACE)
-        {
-            if (it.element->AsSurface()->GetOwnership() & (OWNERSHIP_CONSTRUCTION_RIGHTS_OWNED | OWNERSHIP_OWNED))
-            {
-                tiles++;
-            }
-        }
-    } while (tile_element_iterator_next(&it));
-
+    int32_t tiles = _parkOwnedTileCount;
     if (tiles != gParkSize)
     {
         gParkSize = tiles;
@@ -1103,6 +1087,41 @@ int32_t park_calculate_size()
     return tiles;
 }
 
+static bool park_size_is_owned(uint8_t ownership)
+{
+    return (ownership & (OWNERSHIP_CONSTRUCTION_RIGHTS_OWNED | OWNERSHIP_OWNED)) != 0;
+}
+
+/**
+ * Called whenever the ownership of a surface element in the map changes.
+ */
+void park_size_ownership_changed(uint8_t oldOwnership, uint8_t newOwnership)
+{
+    _parkOwnedTileCount += (int32_t)park_size_is_owned(newOwnership) - (int32_t)park_size_is_owned(oldOwnership);
+}
+
+/**
+ * Counts the owned tiles from scratch, required after the tile elements have been replaced without going through
+ * SurfaceElement::SetOwnership, e.g. when a park is loaded.
+ */
+void park_size_recount()
+{
+    int32_t tiles = 0;
+    tile_element_iterator it;
+    tile_element_iterator_begin(&it);
+    do
+    {
+        if (it.element->GetType() == TILE_ELEMENT_TYPE_SURFACE)
+        {
+            if (park_size_is_owned(it.element->AsSurface()->GetOwnership()))
+            {
+                tiles++;
+            }
+        }
+    } while (tile_element_iterator_next(&it));
+    _parkOwnedTileCount = tiles;
+}
+
 uint8_t calculate_guest_initial_happiness(uint8_t percentage)
 {
     return Park::CalculateGuestInitialHappiness(percentage);
@@ -124,6 +124,8 @@ int32_t get_forced_park_rating();
 
 int32_t park_is_open();
 int32_t park_calculate_size();
+void park_size_ownership_changed(uint8_t oldOwnership, uint8_t newOwnership);
+void park_size_recount();
 
 void reset_park_entry();
 
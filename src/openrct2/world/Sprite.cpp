@@ -35,6 +35,12 @@ static bool _spriteFlashingList[MAX_SPRITES];
 
 uint16_t gSpriteSpatialIndex[0x10001];
 
+// Vehicle only copy of the spatial index so collision detection does not have to walk past every
+// peep and litter sprite. The vehicles are kept in the same order as in the quadrant lists.
+static uint16_t _vehicleSpatialIndex[SPATIAL_INDEX_LOCATION_NULL];
+static uint16_t _vehicleNextInQuadrant[MAX_SPRITES];
+static uint32_t _vehicleQuadrant[MAX_SPRITES];
+
 const rct_string_id litterNames[12] = { STR_LITTER_VOMIT,
                                         STR_LITTER_VOMIT,
                                         STR_SHOP_ITEM_SINGULAR_EMPTY_CAN,
@@ -52,6 +58,8 @@ static LocationXYZ16 _spritelocations1[MAX_SPRITES];
 static LocationXYZ16 _spritelocations2[MAX_SPRITES];
 
 static size_t GetSpatialIndexOffset(int32_t x, int32_t y);
+static void vehicle_spatial_index_insert(uint16_t spriteIndex, size_t quadrantIndex);
+static void vehicle_spatial_index_remove(uint16_t spriteIndex);
 
 rct_sprite* try_get_sprite(size_t spriteIndex)
 {
@@ -75,6 +83,17 @@ uint16_t sprite_get_first_in_quadrant(int32_t x, int32_t y)
     return gSpriteSpatialIndex[offset];
 }
 
+uint16_t sprite_get_first_vehicle_in_quadrant(int32_t x, int32_t y)
+{
+    int32_t offset = ((x & 0x1FE0) << 3) | (y >> 5);
+    return _vehicleSpatialIndex[offset];
+}
+
+uint16_t sprite_get_next_vehicle_in_quadrant(uint16_t spriteIndex)
+{
+    return _vehicleNextInQuadrant[spriteIndex];
+}
+
 static void invalidate_sprite_max_zoom(rct_sprite* sprite, int32_t maxZoom)
 {
     if (sprite->generic.sprite_left == LOCATION_NULL)
@@ -186,6 +205,58 @@ void reset_sprite_spatial_index()
             spr->generic.next_in_quadrant = nextSpriteId;
         }
     }
+    reset_vehicle_spatial_index();
+}
+
+/**
+ * Rebuilds the vehicle spatial index from the quadrant lists, needs to be called whenever
+ * gSpriteSpatialIndex is replaced, e.g. after loading a park.
+ */
+void reset_vehicle_spatial_index()
+{
+    std::fill_n(_vehicleSpatialIndex, Util::CountOf(_vehicleSpatialIndex), SPRITE_INDEX_NULL);
+    std::fill_n(_vehicleNextInQuadrant, Util::CountOf(_vehicleNextInQuadrant), SPRITE_INDEX_NULL);
+    std::fill_n(_vehicleQuadrant, Util::CountOf(_vehicleQuadrant), SPATIAL_INDEX_LOCATION_NULL);
+    for (size_t i = 0; i < SPATIAL_INDEX_LOCATION_NULL; i++)
+    {
+        uint16_t* tail = &_vehicleSpatialIndex[i];
+        // Limit the walk in case the quadrant list contains a cycle
+        size_t count = 0;
+        for (uint16_t spriteIndex = gSpriteSpatialIndex[i]; spriteIndex < MAX_SPRITES && count < MAX_SPRITES;
+             spriteIndex = get_sprite(spriteIndex)->generic.next_in_quadrant, count++)
+        {
+            if (get_sprite(spriteIndex)->generic.sprite_identifier == SPRITE_IDENTIFIER_VEHICLE
+                && _vehicleQuadrant[spriteIndex] == SPATIAL_INDEX_LOCATION_NULL)
+            {
+                *tail = spriteIndex;
+                tail = &_vehicleNextInQuadrant[spriteIndex];
+                _vehicleQuadrant[spriteIndex] = (uint32_t)i;
+            }
+        }
+    }
+}
+
+static void vehicle_spatial_index_insert(uint16_t spriteIndex, size_t quadrantIndex)
+{
+    _vehicleNextInQuadrant[spriteIndex] = _vehicleSpatialIndex[quadrantIndex];
+    _vehicleSpatialIndex[quadrantIndex] = spriteIndex;
+    _vehicleQuadrant[spriteIndex] = (uint32_t)quadrantIndex;
+}
+
+static void vehicle_spatial_index_remove(uint16_t spriteIndex)
+{
+    uint32_t quadrantIndex = _vehicleQuadrant[spriteIndex];
+    if (quadrantIndex == SPATIAL_INDEX_LOCATION_NULL)
+        return;
+
+    uint16_t* index = &_vehicleSpatialIndex[quadrantIndex];
+    while (*index != SPRITE_INDEX_NULL && *index != spriteIndex)
+    {
+        index = &_vehicleNextInQuadrant[*index];
+    }
+    *index = _vehicleNextInQuadrant[spriteIndex];
+    _vehicleNextInQuadrant[spriteIndex] = SPRITE_INDEX_NULL;
+    _vehicleQuadrant[spriteIndex] = SPATIAL_INDEX_LOCATION_NULL;
 }
 
 static size_t GetSpatialIndexOffset(int32_t x, int32_t y)
@@ -611,6 +682,15 @@ void sprite_move(int16_t x, int16_t y, int16_t z, rct_sprite* sprite)
         int32_t tempSpriteIndex = gSpriteSpatialIndex[newIndex];
         gSpriteSpatialIndex[newIndex] = sprite->generic.sprite_index;
         sprite->generic.next_in_quadrant = tempSpriteIndex;
+
+        if (sprite->generic.sprite_identifier == SPRITE_IDENTIFIER_VEHICLE)
+        {
+            vehicle_spatial_index_remove(sprite->generic.sprite_index);
+            if (newIndex != SPATIAL_INDEX_LOCATION_NULL)
+            {
+                vehicle_spatial_index_insert(sprite->generic.sprite_index, newIndex);
+            }
+        }
     }
 
     if (x == LOCATION_NULL)
@@ -677,6 +757,7 @@ void sprite_remove(rct_sprite* sprite)
         spriteIndex = &quadrantSprite->generic.next_in_quadrant;
     }
     *spriteIndex = sprite->generic.next_in_quadrant;
+    vehicle_spatial_index_remove(sprite->generic.sprite_index);
 }
 
 static bool litter_can_be_at(int32_t x, int32_t y, int32_t z)
@@ -12,6 +12,7 @@
 #include "../scenario/Scenario.h"
 #include "Location.hpp"
 #include "Map.h"
+#include "Park.h"
 
 uint32_t SurfaceElement::GetSurfaceStyle() const
 {
@@ -190,6 +191,7 @@ uint8_t SurfaceElement::GetOwnership() const
 
 void SurfaceElement::SetOwnership(uint8_t newOwnership)
 {
+    park_size_ownership_changed(GetOwnership(), newOwnership);
     ownership &= ~TILE_ELEMENT_SURFACE_OWNERSHIP_MASK;
     ownership |= (newOwnership & TILE_ELEMENT_SURFACE_OWNERSHIP_MASK);
 }
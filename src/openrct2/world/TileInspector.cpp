@@ -336,6 +336,10 @@ int32_t tile_inspector_paste_element_at(int32_t x, int32_t y, TileElement elemen
         {
             pastedElement->flags |= TILE_ELEMENT_FLAG_LAST_TILE;
         }
+        if (pastedElement->GetType() == TILE_ELEMENT_TYPE_SURFACE)
+        {
+            park_size_ownership_changed(OWNERSHIP_UNOWNED, pastedElement->AsSurface()->GetOwnership());
+        }
 
         map_invalidate_tile_full(x << 5, y << 5);
 
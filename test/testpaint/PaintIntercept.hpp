@@ -12,6 +12,10 @@
 #include "FunctionCall.hpp"
 
 #include <openrct2/common.h>
+#include <openrct2/paint/Paint.h>
+
+// The session the intercepted paint functions are called with, the game itself allocates its sessions from a pool
+extern paint_session gPaintSession;
 
 namespace PaintIntercept
 {
@@ -11,6 +11,7 @@
 
 #include "GeneralSupportHeightCall.hpp"
 #include "Hook.h"
+#include "PaintIntercept.hpp"
 #include "Printer.hpp"
 #include "SegmentSupportHeightCall.hpp"
 #include "Utils.hpp"
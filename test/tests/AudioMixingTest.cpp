@@ -0,0 +1,86 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2018 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include <gtest/gtest.h>
+#include <openrct2/audio/AudioMixing.h>
+#include <random>
+#include <vector>
+
+using namespace OpenRCT2::Audio;
+
+class AudioMixingTest : public testing::Test
+{
+protected:
+    std::mt19937 _rng{ 42 };
+
+    std::vector<int16_t> CreateSamples(size_t numFrames, int32_t range)
+    {
+        std::uniform_int_distribution<int32_t> dist(-range, range);
+        std::vector<int16_t> samples(numFrames * 2);
+        for (auto& sample : samples)
+        {
+            sample = (int16_t)dist(_rng);
+        }
+        return samples;
+    }
+
+    void CheckMatchesScalar(
+        int32_t range, float startPanL, float startPanR, float panStepL, float panStepR, float startVolume, float volumeStep)
+    {
+        for (size_t numFrames : { 0, 1, 3, 4, 5, 8, 257, 1024 })
+        {
+            auto src = CreateSamples(numFrames, range);
+            auto expected = CreateSamples(numFrames, range);
+            auto actual = expected;
+
+            MixS16StereoScalar(
+                expected.data(), src.data(), numFrames, startPanL, startPanR, panStepL, panStepR, startVolume, volumeStep);
+            MixS16Stereo(
+                actual.data(), src.data(), numFrames, startPanL, startPanR, panStepL, panStepR, startVolume, volumeStep);
+            ASSERT_EQ(expected, actual) << "numFrames " << numFrames;
+        }
+    }
+};
+
+TEST_F(AudioMixingTest, scalar_adds_scaled_samples)
+{
+    const int16_t src[] = { 1000, -1000, 200, 400 };
+    int16_t dst[] = { 10, 20, -30, 40 };
+    MixS16StereoScalar(dst, src, 2, 1.0f, 0.5f, 0.0f, 0.0f, 0.5f, 0.0f);
+    ASSERT_EQ(dst[0], 510);
+    ASSERT_EQ(dst[1], -230);
+    ASSERT_EQ(dst[2], 70);
+    ASSERT_EQ(dst[3], 140);
+}
+
+TEST_F(AudioMixingTest, scalar_saturates)
+{
+    const int16_t src[] = { 30000, -30000 };
+    int16_t dst[] = { 10000, -10000 };
+    MixS16StereoScalar(dst, src, 1, 1.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f);
+    ASSERT_EQ(dst[0], INT16_MAX);
+    ASSERT_EQ(dst[1], INT16_MIN);
+}
+
+TEST_F(AudioMixingTest, constant_gain_matches_scalar)
+{
+    CheckMatchesScalar(8000, 0.8f, 0.3f, 0.0f, 0.0f, 0.75f, 0.0f);
+}
+
+TEST_F(AudioMixingTest, pan_and_fade_match_scalar)
+{
+    CheckMatchesScalar(8000, 1.0f, 0.0f, -0.001f, 0.001f, 0.0f, 0.0005f);
+    CheckMatchesScalar(8000, 0.2f, 0.9f, 0.0003f, -0.0004f, 1.0f, -0.0004f);
+}
+
+TEST_F(AudioMixingTest, saturation_matches_scalar)
+{
+    CheckMatchesScalar(INT16_MAX, 1.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f);
+    CheckMatchesScalar(INT16_MAX, 0.9f, 1.0f, 0.0001f, 0.0f, 0.9f, 0.0001f);
+}
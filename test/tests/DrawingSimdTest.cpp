@@ -0,0 +1,206 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2018 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include <gtest/gtest.h>
+#include <openrct2/drawing/Drawing.h>
+#include <openrct2/drawing/LightFX.h>
+#include <openrct2/util/Util.h>
+#include <random>
+#include <vector>
+
+/**
+ * Checks that the vectorised drawing functions produce the same output as their scalar versions.
+ */
+class DrawingSimdTest : public testing::Test
+{
+protected:
+    using BlitBmpFn = void (*)(int32_t, int32_t, const uint8_t*, uint8_t*, int32_t, int32_t);
+    using BlitBmpPaletteFn = void (*)(int32_t, int32_t, const uint8_t*, uint8_t*, int32_t, int32_t, const uint8_t*, bool);
+
+    std::mt19937 _rng{ 1234 };
+
+    // Random bytes where roughly a quarter are 0, with runs of 0 long enough to cover whole vector blocks
+    std::vector<uint8_t> CreateSprite(size_t length)
+    {
+        std::uniform_int_distribution<int32_t> dist(0, 255);
+        std::vector<uint8_t> data(length);
+        for (size_t i = 0; i < length; i++)
+        {
+            bool transparentBlock = (i / 48) % 3 == 1;
+            int32_t value = dist(_rng);
+            data[i] = transparentBlock || value < 64 ? 0 : (uint8_t)value;
+        }
+        return data;
+    }
+
+    std::vector<uint8_t> CreateRandom(size_t length)
+    {
+        std::uniform_int_distribution<int32_t> dist(0, 255);
+        std::vector<uint8_t> data(length);
+        for (auto& value : data)
+        {
+            value = (uint8_t)dist(_rng);
+        }
+        return data;
+    }
+
+    void CheckBlitBmp(BlitBmpFn fn)
+    {
+        for (int32_t width : { 1, 15, 16, 17, 31, 32, 33, 64, 100 })
+        {
+            for (int32_t srcWrap : { 0, 3 })
+            {
+                const int32_t height = 7;
+                const int32_t dstWrap = 5;
+                auto src = CreateSprite((width + srcWrap) * height);
+                auto expected = CreateRandom((width + dstWrap) * height);
+                auto actual = expected;
+
+                blit_bmp_scalar(width, height, src.data(), expected.data(), srcWrap, dstWrap);
+                fn(width, height, src.data(), actual.data(), srcWrap, dstWrap);
+                ASSERT_EQ(expected, actual) << "width " << width << ", srcWrap " << srcWrap;
+            }
+        }
+    }
+
+    std::vector<uint32_t> CreatePalette32()
+    {
+        std::uniform_int_distribution<uint32_t> dist;
+        std::vector<uint32_t> palette(256);
+        for (auto& colour : palette)
+        {
+            colour = dist(_rng);
+        }
+        return palette;
+    }
+
+    void CheckBlitBmpPalette(BlitBmpPaletteFn fn)
+    {
+        for (bool transparent : { false, true })
+        {
+            // Remaps where colour 0 maps to itself and where it does not
+            for (bool remapZero : { false, true })
+            {
+                auto palette = CreateRandom(256);
+                palette[0] = remapZero ? 12 : 0;
+                palette[1] = 0;
+
+                for (int32_t width : { 1, 15, 16, 17, 31, 32, 33, 64, 100 })
+                {
+                    const int32_t height = 5;
+                    const int32_t srcWrap = 2;
+                    const int32_t dstWrap = 9;
+                    auto src = CreateSprite((width + srcWrap) * height);
+                    auto expected = CreateRandom((width + dstWrap) * height);
+                    auto actual = expected;
+
+                    blit_bmp_palette_scalar(
+                        width, height, src.data(), expected.data(), srcWrap, dstWrap, palette.data(), transparent);
+                    fn(width, height, src.data(), actual.data(), srcWrap, dstWrap, palette.data(), transparent);
+                    ASSERT_EQ(expected, actual) << "width " << width << ", transparent " << transparent << ", remapZero "
+                                                << remapZero;
+                }
+            }
+        }
+    }
+};
+
+TEST_F(DrawingSimdTest, blit_bmp_sse4_1)
+{
+    if (!sse41_available())
+    {
+        return;
+    }
+    CheckBlitBmp(blit_bmp_sse4_1);
+    CheckBlitBmpPalette(blit_bmp_palette_sse4_1);
+}
+
+TEST_F(DrawingSimdTest, blit_bmp_avx2)
+{
+    if (!avx2_available())
+    {
+        return;
+    }
+    CheckBlitBmp(blit_bmp_avx2);
+    CheckBlitBmpPalette(blit_bmp_palette_avx2);
+}
+
+TEST_F(DrawingSimdTest, convert_palette_32_scalar)
+{
+    auto palette = CreatePalette32();
+    const uint8_t src[] = { 0, 1, 255, 7, 128 };
+    uint32_t dst[5] = {};
+    convert_palette_32_scalar(5, 1, src, dst, 0, 0, palette.data());
+    for (size_t i = 0; i < 5; i++)
+    {
+        ASSERT_EQ(palette[src[i]], dst[i]);
+    }
+}
+
+TEST_F(DrawingSimdTest, convert_palette_32_avx2)
+{
+    if (!avx2_available())
+    {
+        return;
+    }
+    auto palette = CreatePalette32();
+    for (int32_t width : { 1, 7, 8, 9, 15, 16, 17, 100 })
+    {
+        const int32_t height = 6;
+        const int32_t srcWrap = 3;
+        const int32_t dstWrap = 5;
+        auto src = CreateRandom((width + srcWrap) * height);
+        std::vector<uint32_t> expected((width + dstWrap) * height, 0xDEADBEEF);
+        auto actual = expected;
+
+        convert_palette_32_scalar(width, height, src.data(), expected.data(), srcWrap, dstWrap, palette.data());
+        convert_palette_32_avx2(width, height, src.data(), actual.data(), srcWrap, dstWrap, palette.data());
+        ASSERT_EQ(expected, actual) << "width " << width;
+    }
+}
+
+#ifdef __ENABLE_LIGHTFX__
+
+TEST_F(DrawingSimdTest, lightfx_add_light_row)
+{
+    for (uint8_t intensity : { 0, 1, 100, 254, 255 })
+    {
+        for (int32_t width : { 1, 15, 16, 17, 40, 256 })
+        {
+            auto src = CreateRandom(width);
+            auto expected = CreateRandom(width);
+            auto actual = expected;
+
+            lightfx_add_light_row_scalar(expected.data(), src.data(), width, intensity);
+            lightfx_add_light_row(actual.data(), src.data(), width, intensity);
+            ASSERT_EQ(expected, actual) << "intensity " << (int32_t)intensity << ", width " << width;
+        }
+    }
+}
+
+TEST_F(DrawingSimdTest, lightfx_blend_row)
+{
+    auto palette = CreatePalette32();
+    auto lightPalette = CreatePalette32();
+    for (uint32_t width : { 1, 3, 4, 5, 8, 64, 101 })
+    {
+        auto bits = CreateRandom(width);
+        // Includes unlit pixels and whole unlit groups of four
+        auto lightBits = CreateSprite(width);
+        std::vector<uint32_t> expected(width);
+        std::vector<uint32_t> actual(width);
+
+        lightfx_blend_row_scalar(
+            expected.data(), bits.data(), lightBits.data(), width, palette.data(), lightPalette.data());
+        lightfx_blend_row(actual.data(), bits.data(), lightBits.data(), width, palette.data(), lightPalette.data());
+        ASSERT_EQ(expected, actual) << "width " << width;
+    }
+}
+
+#endif // __ENABLE_LIGHTFX__
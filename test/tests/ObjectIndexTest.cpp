@@ -0,0 +1,180 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2018 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include <cstring>
+#include <gtest/gtest.h>
+#include <openrct2/core/File.h>
+#include <openrct2/core/FileStream.hpp>
+#include <openrct2/core/IStream.hpp>
+#include <openrct2/core/MemoryMappedFile.h>
+#include <openrct2/core/MemoryStream.h>
+#include <openrct2/object/ObjectRepository.h>
+#include <string>
+#include <vector>
+
+class ObjectIndexTest : public testing::Test
+{
+protected:
+    static constexpr const char* TEMP_FILE = "objectindextest.tmp";
+
+    void TearDown() override
+    {
+        File::Delete(TEMP_FILE);
+    }
+
+    static rct_object_entry CreateEntry(uint8_t type, const char* name, uint32_t checksum)
+    {
+        rct_object_entry entry = {};
+        entry.flags = type;
+        entry.SetName(name);
+        entry.checksum = checksum;
+        return entry;
+    }
+
+    static std::vector<ObjectRepositoryItem> CreateItems()
+    {
+        std::vector<ObjectRepositoryItem> items(3);
+
+        items[0].ObjectEntry = CreateEntry(OBJECT_TYPE_RIDE, "ARRX    ", 0x12345678);
+        items[0].Path = "/objects/rides/arrx.dat";
+        items[0].Name = "Steel Twister Roller Coaster";
+        items[0].Sources = { 1, 3 };
+        items[0].RideInfo.RideFlags = 0x05;
+        for (int32_t i = 0; i < MAX_CATEGORIES_PER_RIDE; i++)
+        {
+            items[0].RideInfo.RideCategory[i] = (uint8_t)(i + 1);
+        }
+        for (int32_t i = 0; i < MAX_RIDE_TYPES_PER_RIDE_ENTRY; i++)
+        {
+            items[0].RideInfo.RideType[i] = (uint8_t)(i + 10);
+        }
+        items[0].RideInfo.RideGroupIndex = 2;
+
+        items[1].ObjectEntry = CreateEntry(OBJECT_TYPE_SCENERY_GROUP, "SCGTREES", 0xCAFEF00D);
+        items[1].Path = "/objects/scenery/scgtrees.dat";
+        items[1].Name = "Trees";
+        items[1].SceneryGroupInfo.Entries = { CreateEntry(OBJECT_TYPE_SMALL_SCENERY, "TCF     ", 1),
+                                              CreateEntry(OBJECT_TYPE_SMALL_SCENERY, "TRF     ", 2) };
+
+        // An item without a name or sources
+        items[2].ObjectEntry = CreateEntry(OBJECT_TYPE_WALLS, "WALLBR16", 7);
+        items[2].Path = "/objects/walls/wallbr16.dat";
+        return items;
+    }
+
+    static std::vector<uint8_t> WriteItems(const std::vector<ObjectRepositoryItem>& items)
+    {
+        MemoryStream ms;
+        WriteObjectIndexItems(&ms, items);
+        auto data = (const uint8_t*)ms.GetData();
+        return std::vector<uint8_t>(data, data + ms.GetLength());
+    }
+
+    static void AssertEntryEqual(const rct_object_entry& expected, const rct_object_entry& actual)
+    {
+        ASSERT_EQ(expected.flags, actual.flags);
+        ASSERT_EQ(0, std::memcmp(expected.nameWOC, actual.nameWOC, sizeof(expected.nameWOC)));
+    }
+};
+
+TEST_F(ObjectIndexTest, memory_mapped_file_reads_contents)
+{
+    const uint8_t data[] = { 1, 2, 3, 4, 5, 250 };
+    File::WriteAllBytes(TEMP_FILE, data, sizeof(data));
+
+    MemoryMappedFile file(TEMP_FILE);
+    ASSERT_EQ(sizeof(data), file.GetLength());
+    ASSERT_NE(nullptr, file.GetData());
+    ASSERT_EQ(0, std::memcmp(data, file.GetData(), sizeof(data)));
+}
+
+TEST_F(ObjectIndexTest, memory_mapped_file_empty)
+{
+    {
+        auto fs = FileStream(TEMP_FILE, FILE_MODE_WRITE);
+    }
+
+    MemoryMappedFile file(TEMP_FILE);
+    ASSERT_EQ(0u, file.GetLength());
+}
+
+TEST_F(ObjectIndexTest, memory_mapped_file_missing)
+{
+    ASSERT_THROW(MemoryMappedFile("objectindextest_missing.tmp"), IOException);
+}
+
+TEST_F(ObjectIndexTest, items_round_trip)
+{
+    auto items = CreateItems();
+    auto data = WriteItems(items);
+    auto result = ReadObjectIndexItems(data.data(), data.size(), (uint32_t)items.size());
+
+    ASSERT_EQ(items.size(), result.size());
+    for (size_t i = 0; i < items.size(); i++)
+    {
+        AssertEntryEqual(items[i].ObjectEntry, result[i].ObjectEntry);
+        ASSERT_EQ(items[i].Path, result[i].Path);
+        ASSERT_EQ(items[i].Name, result[i].Name);
+        ASSERT_EQ(items[i].Sources, result[i].Sources);
+    }
+
+    const auto& ride = result[0].RideInfo;
+    ASSERT_EQ(items[0].RideInfo.RideFlags, ride.RideFlags);
+    ASSERT_EQ(0, std::memcmp(items[0].RideInfo.RideCategory, ride.RideCategory, sizeof(ride.RideCategory)));
+    ASSERT_EQ(0, std::memcmp(items[0].RideInfo.RideType, ride.RideType, sizeof(ride.RideType)));
+    ASSERT_EQ(items[0].RideInfo.RideGroupIndex, ride.RideGroupIndex);
+
+    const auto& expectedEntries = items[1].SceneryGroupInfo.Entries;
+    const auto& entries = result[1].SceneryGroupInfo.Entries;
+    ASSERT_EQ(expectedEntries.size(), entries.size());
+    for (size_t i = 0; i < entries.size(); i++)
+    {
+        AssertEntryEqual(expectedEntries[i], entries[i]);
+    }
+}
+
+TEST_F(ObjectIndexTest, items_round_trip_through_file)
+{
+    auto items = CreateItems();
+    auto data = WriteItems(items);
+    File::WriteAllBytes(TEMP_FILE, data.data(), data.size());
+
+    MemoryMappedFile file(TEMP_FILE);
+    auto result = ReadObjectIndexItems(file.GetData(), file.GetLength(), (uint32_t)items.size());
+    ASSERT_EQ(items.size(), result.size());
+    ASSERT_EQ(items[1].Path, result[1].Path);
+    ASSERT_EQ(items[1].SceneryGroupInfo.Entries.size(), result[1].SceneryGroupInfo.Entries.size());
+}
+
+TEST_F(ObjectIndexTest, empty_index)
+{
+    auto data = WriteItems({});
+    ASSERT_TRUE(data.empty());
+    ASSERT_TRUE(ReadObjectIndexItems(data.data(), data.size(), 0).empty());
+}
+
+TEST_F(ObjectIndexTest, truncated_index_throws)
+{
+    auto items = CreateItems();
+    auto data = WriteItems(items);
+
+    // Every truncation either cuts into the records or the pool they refer to
+    for (size_t length = 0; length < data.size(); length++)
+    {
+        ASSERT_THROW(ReadObjectIndexItems(data.data(), length, (uint32_t)items.size()), IOException) << "length " << length;
+    }
+}
+
+TEST_F(ObjectIndexTest, more_items_than_records_throws)
+{
+    auto items = CreateItems();
+    auto data = WriteItems(items);
+    ASSERT_THROW(ReadObjectIndexItems(data.data(), data.size(), 1000), IOException);
+    ASSERT_THROW(ReadObjectIndexItems(data.data(), data.size(), UINT32_MAX), IOException);
+}
@@ -0,0 +1,152 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2018 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "TestData.h"
+
+#include <cstdlib>
+#include <gtest/gtest.h>
+#include <openrct2/Context.h>
+#include <openrct2/Game.h>
+#include <openrct2/GameState.h>
+#include <openrct2/OpenRCT2.h>
+#include <openrct2/ReplayManager.h>
+#include <openrct2/Version.h>
+#include <openrct2/core/DataSerialiser.h>
+#include <openrct2/core/File.h>
+#include <openrct2/core/MemoryStream.h>
+#include <openrct2/core/Util.hpp>
+#include <openrct2/platform/platform.h>
+#include <openrct2/util/Util.h>
+#include <openrct2/world/Sprite.h>
+#include <string>
+#include <vector>
+
+using namespace OpenRCT2;
+
+class ReplayTest : public testing::Test
+{
+protected:
+    static constexpr const char* TEMP_FILE = "replaytest.tmp";
+
+    // "ORRP" in little endian
+    static constexpr uint32_t REPLAY_MAGIC = 0x5052524F;
+    static constexpr uint16_t REPLAY_VERSION = 1;
+
+    void TearDown() override
+    {
+        File::Delete(TEMP_FILE);
+    }
+
+    // The sprites in every quadrant list, in list order
+    static std::vector<std::vector<uint16_t>> GetQuadrantLists()
+    {
+        std::vector<std::vector<uint16_t>> lists(Util::CountOf(gSpriteSpatialIndex));
+        for (size_t i = 0; i < lists.size(); i++)
+        {
+            // Limit the walk in case the list contains a cycle
+            for (uint16_t spriteIndex = gSpriteSpatialIndex[i]; spriteIndex < MAX_SPRITES && lists[i].size() <= MAX_SPRITES;
+                 spriteIndex = get_sprite(spriteIndex)->generic.next_in_quadrant)
+            {
+                lists[i].push_back(spriteIndex);
+            }
+        }
+        return lists;
+    }
+
+    // A replay with no park data and a single game action of the given type
+    static void WriteReplayWithAction(uint32_t type)
+    {
+        MemoryStream stream;
+        DataSerialiser serialiser(true, stream);
+
+        std::string gameVersion = gVersionInfoFull;
+        uint32_t tickStart = 0;
+        uint32_t tickEnd = 1;
+        uint32_t checksumInterval = 0;
+        uint32_t parkDataSize = 0;
+        uint32_t numCommands = 1;
+        uint32_t tick = 0;
+        uint8_t playerId = 0;
+        bool isAction = true;
+        uint32_t numChecksums = 0;
+        serialiser << gameVersion << tickStart << tickEnd << checksumInterval << parkDataSize;
+        serialiser << numCommands << tick << playerId << isAction << type;
+        serialiser << numChecksums;
+
+        size_t compressedSize = 0;
+        uint8_t* compressed = util_zlib_deflate((const uint8_t*)stream.GetData(), stream.GetLength(), &compressedSize);
+        ASSERT_NE(compressed, nullptr);
+
+        MemoryStream fileStream;
+        fileStream.WriteValue<uint32_t>(REPLAY_MAGIC);
+        fileStream.WriteValue<uint16_t>(REPLAY_VERSION);
+        fileStream.WriteValue<uint32_t>((uint32_t)stream.GetLength());
+        fileStream.Write(compressed, compressedSize);
+        File::WriteAllBytes(TEMP_FILE, fileStream.GetData(), fileStream.GetLength());
+        free(compressed);
+    }
+};
+
+TEST_F(ReplayTest, load_park_keeps_quadrant_lists)
+{
+    std::string path = TestData::GetParkPath("bpb.sv6");
+
+    gOpenRCT2Headless = true;
+    gOpenRCT2NoGraphics = true;
+
+    core_init();
+    auto context = CreateContext();
+    ASSERT_TRUE(context->Initialise());
+
+    load_from_sv6(path.c_str());
+    game_load_init();
+
+    // Let guests move between quadrants so the lists are no longer in the order a rebuild gives
+    auto gs = context->GetGameState();
+    for (int i = 0; i < 100; i++)
+    {
+        gs->UpdateLogic();
+    }
+    auto expected = GetQuadrantLists();
+
+    auto replayManager = context->GetReplayManager();
+    ASSERT_TRUE(replayManager->StartRecording(TEMP_FILE));
+    ASSERT_TRUE(replayManager->StopRecording());
+    ASSERT_TRUE(replayManager->StartPlayback(TEMP_FILE));
+    auto actual = GetQuadrantLists();
+    replayManager->StopPlayback();
+
+    // Every sprite is reachable from its quadrant head exactly once
+    std::vector<int32_t> reached(MAX_SPRITES);
+    for (const auto& list : actual)
+    {
+        for (auto spriteIndex : list)
+        {
+            reached[spriteIndex]++;
+        }
+    }
+    for (size_t i = 0; i < MAX_SPRITES; i++)
+    {
+        bool isNull = get_sprite(i)->generic.sprite_identifier == SPRITE_IDENTIFIER_NULL;
+        ASSERT_EQ(reached[i], isNull ? 0 : 1) << "sprite " << i;
+    }
+
+    ASSERT_EQ(expected, actual);
+}
+
+TEST_F(ReplayTest, unknown_action_type_fails_to_load)
+{
+    auto replayManager = CreateReplayManager();
+    for (uint32_t type : { (uint32_t)GAME_COMMAND_SET_RIDE_APPEARANCE, (uint32_t)GAME_COMMAND_COUNT, UINT32_MAX })
+    {
+        WriteReplayWithAction(type);
+        ASSERT_FALSE(replayManager->StartPlayback(TEMP_FILE)) << "type " << type;
+        ASSERT_FALSE(replayManager->IsReplaying());
+    }
+}
@@ -0,0 +1,228 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2018 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include <gtest/gtest.h>
+#include <openrct2/drawing/Drawing.h>
+#include <random>
+#include <vector>
+
+class SpriteMipCacheTest : public testing::Test
+{
+protected:
+    static constexpr int32_t IMAGE_ID = 1;
+    static constexpr int32_t VIEW_WIDTH = 128;
+    static constexpr int32_t VIEW_HEIGHT = 96;
+    static constexpr uint8_t BACKGROUND = 0xFF;
+
+    std::vector<uint8_t> _pixels;
+    std::vector<uint8_t> _rle;
+    rct_g1_element _g1 = {};
+
+    void SetUp() override
+    {
+        sprite_mip_cache_clear();
+    }
+
+    void TearDown() override
+    {
+        sprite_mip_cache_clear();
+    }
+
+    // Random pixels with transparent holes, palette index 0 is transparent
+    void CreatePixels(int32_t width, int32_t height)
+    {
+        std::mt19937 rng(width * 31 + height);
+        std::uniform_int_distribution<int32_t> dist(0, 255);
+        _pixels.resize(width * height);
+        for (auto& pixel : _pixels)
+        {
+            int32_t value = dist(rng);
+            pixel = value < 64 ? 0 : (uint8_t)value;
+        }
+    }
+
+    void CreateBmpElement(int32_t width, int32_t height)
+    {
+        CreatePixels(width, height);
+        _g1 = {};
+        _g1.offset = _pixels.data();
+        _g1.width = width;
+        _g1.height = height;
+        _g1.flags = G1_FLAG_BMP;
+    }
+
+    void CreateRleElement(int32_t width, int32_t height)
+    {
+        CreatePixels(width, height);
+        _rle.assign(height * 2, 0);
+        for (int32_t y = 0; y < height; y++)
+        {
+            uint16_t lineOffset = (uint16_t)_rle.size();
+            _rle[y * 2] = lineOffset & 0xFF;
+            _rle[y * 2 + 1] = lineOffset >> 8;
+
+            size_t lastRunHeader = SIZE_MAX;
+            for (int32_t x = 0; x < width;)
+            {
+                const uint8_t* row = &_pixels[y * width];
+                if (row[x] == 0)
+                {
+                    x++;
+                    continue;
+                }
+                int32_t runLength = 0;
+                while (x + runLength < width && runLength < 127 && row[x + runLength] != 0)
+                {
+                    runLength++;
+                }
+                lastRunHeader = _rle.size();
+                _rle.push_back((uint8_t)runLength);
+                _rle.push_back((uint8_t)x);
+                _rle.insert(_rle.end(), row + x, row + x + runLength);
+                x += runLength;
+            }
+            if (lastRunHeader == SIZE_MAX)
+            {
+                _rle.push_back(0x80);
+                _rle.push_back(0);
+            }
+            else
+            {
+                _rle[lastRunHeader] |= 0x80;
+            }
+        }
+        _g1 = {};
+        _g1.offset = _rle.data();
+        _g1.width = width;
+        _g1.height = height;
+        _g1.flags = G1_FLAG_RLE_COMPRESSION;
+    }
+
+    static rct_drawpixelinfo CreateDpi(std::vector<uint8_t>& bits, int32_t zoomLevel, int32_t x, int32_t y)
+    {
+        bits.assign((VIEW_WIDTH >> zoomLevel) * (VIEW_HEIGHT >> zoomLevel), BACKGROUND);
+        rct_drawpixelinfo dpi = {};
+        dpi.bits = bits.data();
+        dpi.x = x;
+        dpi.y = y;
+        dpi.width = VIEW_WIDTH;
+        dpi.height = VIEW_HEIGHT;
+        dpi.pitch = 0;
+        dpi.zoom_level = zoomLevel;
+        return dpi;
+    }
+
+    // A remap palette where some colours map to 0
+    static std::vector<uint8_t> CreatePalette()
+    {
+        std::mt19937 rng(7);
+        std::uniform_int_distribution<int32_t> dist(0, 255);
+        std::vector<uint8_t> palette(256);
+        for (auto& colour : palette)
+        {
+            int32_t value = dist(rng);
+            colour = value < 32 ? 0 : (uint8_t)value;
+        }
+        return palette;
+    }
+
+    // Draws the element at every zoom level, position and offset parity, both by sampling it and from the mip cache
+    // where the image type allows it
+    void CheckMatchesSampledImage(int32_t imageType = 0, uint8_t* palette = nullptr)
+    {
+        bool canUseMip = imageType == 0 || (_g1.flags & G1_FLAG_RLE_COMPRESSION);
+        for (int32_t zoomLevel = 1; zoomLevel <= 3; zoomLevel++)
+        {
+            // Includes a view that starts left of and above the image to check clipping
+            for (int32_t viewOrigin : { 0, -16 })
+            {
+                for (int32_t offset : { 0, -3, 5 })
+                {
+                    _g1.x_offset = offset;
+                    _g1.y_offset = -offset;
+                    for (int32_t y = -9; y <= 9; y++)
+                    {
+                        for (int32_t x = -9; x <= 9; x++)
+                        {
+                            std::vector<uint8_t> expected;
+                            auto expectedDpi = CreateDpi(expected, zoomLevel, viewOrigin, viewOrigin);
+                            gfx_draw_g1_element_software(&expectedDpi, &_g1, imageType, x, y, palette);
+
+                            std::vector<uint8_t> actual;
+                            auto actualDpi = CreateDpi(actual, zoomLevel, viewOrigin, viewOrigin);
+                            ASSERT_EQ(
+                                canUseMip,
+                                gfx_draw_g1_element_mip_software(&actualDpi, IMAGE_ID, &_g1, imageType, x, y, palette));
+                            if (!canUseMip)
+                            {
+                                gfx_draw_g1_element_software(&actualDpi, &_g1, imageType, x, y, palette);
+                            }
+
+                            ASSERT_EQ(expected, actual) << "zoom " << zoomLevel << ", view " << viewOrigin << ", offset "
+                                                        << offset << ", x " << x << ", y " << y;
+                        }
+                    }
+                }
+            }
+        }
+    }
+};
+
+TEST_F(SpriteMipCacheTest, bmp_matches_sampled_image)
+{
+    CreateBmpElement(37, 29);
+    CheckMatchesSampledImage();
+}
+
+TEST_F(SpriteMipCacheTest, rle_matches_sampled_image)
+{
+    CreateRleElement(37, 29);
+    CheckMatchesSampledImage();
+}
+
+TEST_F(SpriteMipCacheTest, rle_odd_sizes_match_sampled_image)
+{
+    for (int32_t size : { 1, 2, 3, 8, 15 })
+    {
+        CreateRleElement(size, size + 2);
+        CheckMatchesSampledImage();
+        CreateBmpElement(size + 2, size);
+        CheckMatchesSampledImage();
+    }
+}
+
+TEST_F(SpriteMipCacheTest, bmp_remap_and_transparent_match_sampled_image)
+{
+    auto palette = CreatePalette();
+    CreateBmpElement(37, 29);
+    const int32_t imageTypes[] = { IMAGE_TYPE_REMAP, IMAGE_TYPE_TRANSPARENT, IMAGE_TYPE_REMAP | IMAGE_TYPE_TRANSPARENT };
+    for (int32_t imageType : imageTypes)
+    {
+        CheckMatchesSampledImage(imageType, palette.data());
+    }
+}
+
+TEST_F(SpriteMipCacheTest, rle_remap_and_transparent_match_sampled_image)
+{
+    auto palette = CreatePalette();
+    CreateRleElement(37, 29);
+    const int32_t imageTypes[] = { IMAGE_TYPE_REMAP, IMAGE_TYPE_TRANSPARENT };
+    for (int32_t imageType : imageTypes)
+    {
+        CheckMatchesSampledImage(imageType, palette.data());
+    }
+}
+
+TEST_F(SpriteMipCacheTest, wide_images_are_not_cached)
+{
+    CreateRleElement(600, 4);
+    std::vector<uint8_t> bits;
+    auto dpi = CreateDpi(bits, 1, 0, 0);
+    ASSERT_FALSE(gfx_draw_g1_element_mip_software(&dpi, IMAGE_ID, &_g1, 0, 0, 0, nullptr));
+}
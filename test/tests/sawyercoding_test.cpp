@@ -7,10 +7,12 @@
  * OpenRCT2 is licensed under the GNU General Public License version 3.
  *****************************************************************************/
 
+#include <algorithm>
 #include <gtest/gtest.h>
 #include <openrct2/core/MemoryStream.h>
 #include <openrct2/rct12/SawyerChunkReader.h>
 #include <openrct2/util/SawyerCoding.h>
+#include <vector>
 
 constexpr size_t BUFFER_SIZE = 0x600000;
 
@@ -59,6 +61,22 @@ protected:
         auto result = memcmp(chunk->GetData(), randomdata, sizeof(randomdata));
         ASSERT_EQ(result, 0);
     }
+
+    // Random data followed by long and short runs of a repeated byte, so the encoding has both literal and repeat runs
+    static std::vector<uint8_t> create_td6_data()
+    {
+        std::vector<uint8_t> data(randomdata, randomdata + sizeof(randomdata));
+        data.insert(data.begin() + 100, 300, 0x55);
+        data.insert(data.begin() + 700, 3, 0xAA);
+        return data;
+    }
+
+    static std::vector<uint8_t> encode_td6(const std::vector<uint8_t>& data)
+    {
+        std::vector<uint8_t> encoded(data.size() * 2 + 4);
+        encoded.resize(sawyercoding_encode_td6(data.data(), encoded.data(), data.size()));
+        return encoded;
+    }
 };
 
 TEST_F(SawyerCodingTest, write_read_chunk_none)
@@ -106,6 +124,47 @@ TEST_F(SawyerCodingTest, decode_chunk_rotate)
     test_decode(rotatedata, sizeof(rotatedata));
 }
 
+TEST_F(SawyerCodingTest, decode_td6_header)
+{
+    auto data = create_td6_data();
+    auto encoded = encode_td6(data);
+
+    std::vector<uint8_t> decoded(data.size());
+    ASSERT_EQ(sawyercoding_decode_td6(encoded.data(), decoded.data(), encoded.size()), data.size());
+    ASSERT_EQ(decoded, data);
+
+    for (size_t headerLength : { 0, 1, 99, 100, 101, 127, 128, 129, 399, 400, 401, 1000, 1327, 1328, 2000 })
+    {
+        // The byte after the header must be left alone
+        std::vector<uint8_t> header(headerLength + 1, 0xCD);
+        auto length = sawyercoding_decode_td6_header(encoded.data(), header.data(), encoded.size(), headerLength);
+        ASSERT_EQ(length, std::min(headerLength, data.size())) << "headerLength " << headerLength;
+        ASSERT_EQ(memcmp(header.data(), data.data(), length), 0) << "headerLength " << headerLength;
+        for (size_t i = length; i < header.size(); i++)
+        {
+            ASSERT_EQ(header[i], 0xCD) << "headerLength " << headerLength << ", i " << i;
+        }
+    }
+}
+
+TEST_F(SawyerCodingTest, decode_td6_header_truncated)
+{
+    auto data = create_td6_data();
+    auto encoded = encode_td6(data);
+
+    // Every cut lands somewhere inside a run header, literal run or repeat run
+    for (size_t cut = 0; cut <= encoded.size() - 4; cut++)
+    {
+        // Copy into a buffer of exactly the truncated size so reading past it is caught by sanitizers
+        std::vector<uint8_t> truncated(encoded.begin(), encoded.begin() + cut);
+        truncated.resize(cut + 4);
+        std::vector<uint8_t> header(data.size());
+        auto length = sawyercoding_decode_td6_header(truncated.data(), header.data(), truncated.size(), data.size());
+        ASSERT_LE(length, data.size()) << "cut " << cut;
+        ASSERT_EQ(memcmp(header.data(), data.data(), length), 0) << "cut " << cut;
+    }
+}
+
 // 1024 bytes of random data
 // use `dd if=/dev/urandom bs=1024 count=1 | xxd -i` to get your own
 const uint8_t SawyerCodingTest::randomdata[] = {